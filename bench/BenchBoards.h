@@ -0,0 +1,44 @@
+#pragma once
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+// The benchmarks' boards, as row-major cells ('#' a wall, ' ' free): open ground and mazes.
+
+// open ground: wallPercent of the cells walls, scattered around
+inline std::vector<char> makeOpenField(int size, int wallPercent, unsigned seed) {
+    std::vector<char> cells(static_cast<size_t>(size) * size, ' ');
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> roll(0, 99);
+    for (char& c : cells) c = roll(rng) < wallPercent ? '#' : ' ';
+    return cells;
+}
+
+// odd size, walls everywhere, then a randomized depth-first walk carves the corridors
+inline std::vector<char> makeMaze(int size, unsigned seed) {
+    std::vector<char> cells(static_cast<size_t>(size) * size, '#');
+    std::mt19937 rng(seed);
+    const int dx[4] = {2, -2, 0, 0};
+    const int dy[4] = {0, 0, 2, -2};
+    std::vector<int> stack = {size + 1};
+    cells[size + 1] = ' ';
+    while (!stack.empty()) {
+        int cur = stack.back();
+        int x = cur % size, y = cur / size;
+        int dirs[4] = {0, 1, 2, 3};
+        std::shuffle(dirs, dirs + 4, rng);
+        bool carved = false;
+        for (int d : dirs) {
+            int nx = x + dx[d], ny = y + dy[d];
+            if (nx < 1 || ny < 1 || nx >= size - 1 || ny >= size - 1 || cells[ny * size + nx] != '#') continue;
+            cells[(y + dy[d] / 2) * size + (x + dx[d] / 2)] = ' ';
+            cells[ny * size + nx] = ' ';
+            stack.push_back(ny * size + nx);
+            carved = true;
+            break;
+        }
+        if (!carved) stack.pop_back();
+    }
+    return cells;
+}
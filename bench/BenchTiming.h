@@ -0,0 +1,17 @@
+#pragma once
+
+#include <chrono>
+
+// The benchmarks' clock: milliseconds since a start point, and what a callable takes (an
+// average over a number of runs).
+
+inline double msSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+template<typename F>
+double timeMs(F&& f, int repeats = 1) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < repeats; ++i) f();
+    return msSince(start) / repeats;
+}
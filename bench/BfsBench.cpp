@@ -0,0 +1,267 @@
+// Path search benchmark: GridBfs (flat arrays, stamped visited marks, buffers kept between
+// searches - HunterAlgo's path search until the DistanceField planner replaced it, kept here as
+// the reference) against the search HunterAlgo used before it (vector<vector<bool>> visited,
+// vector<vector<Position>> parents and a std::queue, all allocated per search).
+// Runs on mazes (one corridor-wide, a single path between any two cells) so most searches
+// cover a good part of the board. both must return the same paths (GridBfs wraps around the
+// edges and the old search didn't, but the mazes are walled all round).
+// Then one turn of a team of hunters: a 4-neighbour search per hunter to its nearest enemy,
+// against one DistanceField over (cell, direction) from all the enemies, read by every hunter -
+// the time, and how many game steps (moves and rotations) the hunters need to get there.
+// usage: BfsBench [searches on 256x256=2000] [searches on 2048x2048=20] [hunters=30] [enemies=10]
+// exits with 1 if the paths differ.
+
+#include "DistanceField.h"
+#include "Topology.h"
+#include "BenchTiming.h"
+#include "BenchBoards.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <queue>
+#include <random>
+#include <vector>
+
+namespace {
+
+// Breadth-first search over a flat, row-major grid of view symbols ('#' blocks, anything else
+// is free), 4 neighbours, wrapping around the edges like the board (Topology). All the storage
+// is kept between searches and only grows: visited marks are generation stamps, so a new search
+// doesn't clear anything, and the queue is a fixed array of one slot per cell (every cell is
+// queued at most once). one instance can serve any number of searches.
+class GridBfs {
+public:
+    static constexpr char BLOCKED = '#';
+
+    // shortest path from start to goal, both included, into path (cleared first).
+    // returns false (and leaves path empty) if the goal can't be reached
+    bool findPath(const char* cells, int width, int height, Position start, Position goal,
+                  std::vector<Position>& path) {
+        path.clear();
+        if (width <= 0 || height <= 0) return false;
+        prepare(width * height);
+
+        Topology topology(width, height);
+        int startCell = topology.indexOf(start);
+        int goalCell = topology.indexOf(goal);
+        int head = 0, tail = 0;
+        queue_[tail++] = startCell;
+        visited_[startCell] = generation_;
+
+        auto visit = [&](int cell, int from) {
+            if (isVisited(cell) || cells[cell] == BLOCKED) return;
+            visited_[cell] = generation_;
+            parent_[cell] = from;
+            queue_[tail++] = cell;
+        };
+
+        // same neighbour order as the old search (right, left, down, up), so the same path comes out
+        while (head < tail) {
+            int cur = queue_[head++];
+            if (cur == goalCell) break;
+            int y = cur / width;
+            int x = cur - y * width;
+            // around the edges. they are rare, so plain branches predict well - faster here than
+            // Topology's masks
+            visit(x + 1 < width ? cur + 1 : cur + 1 - width, cur);
+            visit(x > 0 ? cur - 1 : cur - 1 + width, cur);
+            visit(y + 1 < height ? cur + width : x, cur);
+            visit(y > 0 ? cur - width : cur - width + width * height, cur);
+        }
+
+        if (!isVisited(goalCell)) return false;
+
+        for (int cell = goalCell; cell != startCell; cell = parent_[cell]) {
+            path.push_back(topology.positionOf(cell));
+        }
+        path.push_back(start);
+        std::reverse(path.begin(), path.end());
+        return true;
+    }
+
+private:
+    void prepare(int cellCount) {
+        if (static_cast<int>(visited_.size()) < cellCount) {
+            visited_.resize(cellCount, 0);
+            parent_.resize(cellCount);
+            queue_.resize(cellCount);
+        }
+        if (++generation_ == 0) {
+            // the stamps went all the way around - forget them once, start again from 1
+            std::fill(visited_.begin(), visited_.end(), 0);
+            generation_ = 1;
+        }
+    }
+    bool isVisited(int cell) const { return visited_[cell] == generation_; }
+
+    std::vector<uint32_t> visited_;  // == generation_: reached in the current search
+    std::vector<int32_t> parent_;    // valid for visited cells only
+    std::vector<int32_t> queue_;
+    uint32_t generation_ = 0;
+};
+
+// the old HunterAlgo::runBFS, as it was
+std::vector<Position> legacyBfs(const Position& start, const Position& goal,
+                                const std::vector<std::vector<char>>& grid) {
+    int rows = grid.size();
+    int cols = grid[0].size();
+    std::vector<std::vector<bool>> visited(rows, std::vector<bool>(cols, false));
+    std::vector<std::vector<Position>> parent(rows, std::vector<Position>(cols, Position(-1, -1)));
+    std::queue<Position> q;
+
+    q.push(start);
+    visited[start.getY()][start.getX()] = true;
+    const int dx[4] = {1, -1, 0, 0};
+    const int dy[4] = {0, 0, 1, -1};
+    while (!q.empty()) {
+        Position cur = q.front();
+        q.pop();
+        if (cur == goal) break;
+        for (int i = 0; i < 4; ++i) {
+            int nx = cur.getX() + dx[i];
+            int ny = cur.getY() + dy[i];
+            if (nx < 0 || ny < 0 || nx >= cols || ny >= rows) continue;
+            if (visited[ny][nx]) continue;
+            if (grid[ny][nx] == '#') continue;
+            visited[ny][nx] = true;
+            parent[ny][nx] = cur;
+            q.emplace(nx, ny);
+        }
+    }
+    if (!visited[goal.getY()][goal.getX()]) return {};
+
+    std::vector<Position> path;
+    Position step = goal;
+    while (!(step == start)) {
+        path.push_back(step);
+        step = parent[step.getY()][step.getX()];
+    }
+    path.push_back(start);
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+// false if the paths differ
+bool run(int size, int searches) {
+    std::vector<char> cells = makeMaze(size, 18);
+    std::vector<std::vector<char>> grid(size);
+    for (int y = 0; y < size; ++y) grid[y].assign(cells.begin() + y * size, cells.begin() + (y + 1) * size);
+
+    // corridor cells (odd coordinates) as endpoints
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> coord(0, size / 2 - 1);
+    std::vector<std::pair<Position, Position>> queries(searches);
+    for (auto& q : queries) {
+        q = {Position(2 * coord(rng) + 1, 2 * coord(rng) + 1), Position(2 * coord(rng) + 1, 2 * coord(rng) + 1)};
+    }
+
+    std::vector<std::vector<Position>> legacyPaths(searches);
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < searches; ++i) legacyPaths[i] = legacyBfs(queries[i].first, queries[i].second, grid);
+    double legacyMs = msSince(start);
+
+    GridBfs bfs;
+    std::vector<Position> path;
+    bool same = true;
+    long pathCells = 0;
+    double flatMs = 0;
+    for (int i = 0; i < searches; ++i) {
+        start = std::chrono::steady_clock::now();
+        bfs.findPath(cells.data(), size, size, queries[i].first, queries[i].second, path);
+        flatMs += msSince(start);
+        pathCells += static_cast<long>(path.size());
+        same = same && path == legacyPaths[i];
+    }
+
+    std::cout << size << "x" << size << " maze, " << searches << " searches (avg path "
+              << pathCells / std::max(searches, 1) << " cells):\n"
+              << "  per-search allocation: " << legacyMs << " ms, " << searches / (legacyMs / 1000.0) << " searches/s\n"
+              << "  GridBfs:               " << flatMs << " ms, " << searches / (flatMs / 1000.0) << " searches/s (x"
+              << legacyMs / flatMs << ")" << (same ? "" : "  PATHS DIFFER") << "\n";
+    return same;
+}
+
+// 4-neighbour moves from a to b, around the torus
+int manhattan(const Topology& topology, Position a, Position b) {
+    return std::abs(topology.deltaX(a.getX(), b.getX())) + std::abs(topology.deltaY(a.getY(), b.getY()));
+}
+
+// game steps to walk a 4-neighbour path, facing `dir` at the start: a move per cell, plus
+// one rotate-90 action before every 90 degree turn (two for a u-turn)
+long stepsAlong(const Topology& topology, const std::vector<Position>& path, Direction dir) {
+    long steps = 0;
+    for (size_t i = 1; i < path.size(); ++i) {
+        Direction need = topology.directionTo(path[i - 1], path[i]);
+        int eighths = (DIRECTION_CLOCKWISE_INDEX[static_cast<int>(need)] - DIRECTION_CLOCKWISE_INDEX[static_cast<int>(dir)] + 8) % 8;
+        steps += (eighths == 4 ? 2 : eighths == 0 ? 0 : 1) + 1;
+        dir = need;
+    }
+    return steps;
+}
+
+void runTeam(const char* terrain, std::vector<char> cells, int size, int hunters, int enemies) {
+    BattlefieldSnapshot snapshot(size, size, cells);
+    std::mt19937 rng(9);
+    std::uniform_int_distribution<int> coord(0, size - 1);
+    auto freeCell = [&] {
+        for (;;) {
+            Position p(coord(rng), coord(rng));
+            if (cells[p.getY() * size + p.getX()] != '#') return p;
+        }
+    };
+    std::vector<Position> hunterPos(hunters), enemyPos(enemies);
+    for (auto& p : hunterPos) p = freeCell();
+    for (auto& p : enemyPos) p = freeCell();
+    const Direction startDir = Direction::Left;  // how player 2's tanks start
+
+    // what HunterAlgo did: every hunter searches a 4-neighbour path to the manhattan-closest
+    // enemy, and turns where the path turns (both around the torus, as the field is)
+    Topology topology(size, size);
+    GridBfs bfs;
+    std::vector<Position> path;
+    long perHunterSteps = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (const Position& h : hunterPos) {
+        Position target = enemyPos.front();
+        for (const Position& e : enemyPos) {
+            if (manhattan(topology, h, e) < manhattan(topology, h, target)) target = e;
+        }
+        bfs.findPath(cells.data(), size, size, h, target, path);
+        perHunterSteps += stepsAlong(topology, path, startDir);
+    }
+    double perHunterMs = msSince(start);
+
+    // one field over all the (cell, direction) states, from all the enemies
+    DistanceField field;
+    long fieldSteps = 0;
+    start = std::chrono::steady_clock::now();
+    field.compute(snapshot, enemyPos);
+    for (const Position& h : hunterPos) {
+        if (field.nextActionFrom(h, startDir) != ActionRequest::DoNothing) fieldSteps += field.distanceAt(h, startDir);
+    }
+    double fieldMs = msSince(start);
+
+    std::cout << size << "x" << size << " " << terrain << ", " << hunters << " hunters, " << enemies << " enemies, one turn:\n"
+              << "  search per hunter:   " << perHunterMs << " ms, " << perHunterSteps << " game steps to the targets\n"
+              << "  one oriented field:  " << fieldMs << " ms, " << fieldSteps << " game steps to the nearest enemies ("
+              << static_cast<long>(snapshot.getWidth() * snapshot.getHeight() * DIRECTION_COUNT / (fieldMs / 1000.0))
+              << " states/s)\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int smallSearches = argc > 1 ? std::atoi(argv[1]) : 2000;
+    int largeSearches = argc > 2 ? std::atoi(argv[2]) : 20;
+    int hunters = argc > 3 ? std::atoi(argv[3]) : 30;
+    int enemies = argc > 4 ? std::atoi(argv[4]) : 10;
+    bool same = run(255, smallSearches);   // mazes need an odd size
+    same = run(2047, largeSearches) && same;
+    runTeam("maze", makeMaze(255, 18), 255, hunters, enemies);
+    runTeam("open field", makeOpenField(255, 15, 19), 255, hunters, enemies);
+    runTeam("maze", makeMaze(1023, 18), 1023, hunters, enemies);
+    runTeam("open field", makeOpenField(1023, 15, 19), 1023, hunters, enemies);
+    return same ? 0 : 1;
+}
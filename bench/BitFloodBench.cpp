@@ -0,0 +1,109 @@
+// Flood fill benchmark: BitFlood (scalar and AVX2 kernels) against a cell-by-cell BFS over a
+// flat array, all wrapping around the board like the game does - exact distances, and which
+// cells can be reached at all. every kernel must agree with the BFS.
+// usage: BitFloodBench [board size=4096] [sources=10] [repeats=3]
+// exits with 1 if a kernel disagrees with the BFS.
+
+#include "BitFlood.h"
+#include "BenchTiming.h"
+#include "BenchBoards.h"
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace {
+
+// the reference: one cell at a time, 4 neighbours, wrapping
+void bfsDistances(const std::vector<char>& cells, int size, const std::vector<int>& sources,
+                  std::vector<int32_t>& dist, std::vector<int32_t>& queue) {
+    dist.assign(cells.size(), BitFlood::UNREACHABLE);
+    queue.resize(cells.size());
+    int head = 0, tail = 0;
+    for (int s : sources) {
+        if (cells[s] == '#' || dist[s] == 0) continue;
+        dist[s] = 0;
+        queue[tail++] = s;
+    }
+    while (head < tail) {
+        int cur = queue[head++];
+        int y = cur / size, x = cur - y * size;
+        int32_t next = dist[cur] + 1;
+        const int around[4] = {y * size + (x + 1) % size, y * size + (x + size - 1) % size,
+                               ((y + 1) % size) * size + x, ((y + size - 1) % size) * size + x};
+        for (int n : around) {
+            if (dist[n] != BitFlood::UNREACHABLE || cells[n] == '#') continue;
+            dist[n] = next;
+            queue[tail++] = n;
+        }
+    }
+}
+
+// sourceCount random free cells, or (sourceCount 0) every free cell of the first row. none on
+// a board without a free cell. false if a kernel disagrees with the BFS
+bool run(const char* name, const std::vector<char>& cells, int size, int sourceCount, int repeats) {
+    std::mt19937 rng(21);
+    std::uniform_int_distribution<int> cell(0, size * size - 1);
+    std::vector<int> sources;
+    bool anyFree = std::count(cells.begin(), cells.end(), '#') < static_cast<long>(cells.size());
+    while (anyFree && static_cast<int>(sources.size()) < sourceCount) {
+        int s = cell(rng);
+        if (cells[s] != '#') sources.push_back(s);
+    }
+    for (int x = 0; sourceCount == 0 && x < size; ++x) {
+        if (cells[x] != '#') sources.push_back(x);
+    }
+
+    BitGrid passable(size, size), sourceBits(size, size);
+    for (int y = 0; y < size; ++y)
+        for (int x = 0; x < size; ++x)
+            if (cells[y * size + x] != '#') passable.set(x, y);
+    for (int s : sources) sourceBits.set(s % size, s / size);
+
+    std::vector<int32_t> expected, queue;
+    double bfsMs = timeMs([&] { bfsDistances(cells, size, sources, expected, queue); }, repeats);
+    int32_t layers = *std::max_element(expected.begin(), expected.end());
+    bool same = true;
+    std::cout << size << "x" << size << " " << name << ", " << sources.size() << " sources, " << layers << " layers:\n"
+              << "  cell-by-cell BFS: " << bfsMs << " ms\n";
+
+    for (BitFlood::Kernel kernel : {BitFlood::Kernel::Scalar, BitFlood::Kernel::AVX2}) {
+        if (!BitFlood::isSupported(kernel)) continue;
+        BitFlood flood(kernel);
+        std::vector<int32_t> dist;
+        double ms = timeMs([&] { flood.distances(passable, sourceBits, dist); }, repeats);
+        std::cout << "  BitFlood distances, " << BitFlood::kernelName(kernel) << ": " << ms << " ms (x" << bfsMs / ms << ")"
+                  << (dist == expected ? "" : "  MISMATCH") << "\n";
+        same = same && dist == expected;
+    }
+    for (BitFlood::Kernel kernel : {BitFlood::Kernel::Scalar, BitFlood::Kernel::AVX2}) {
+        if (!BitFlood::isSupported(kernel)) continue;
+        BitFlood flood(kernel);
+        BitGrid reached;
+        double ms = timeMs([&] { flood.reachable(passable, sourceBits, reached); }, repeats);
+        bool reachedSame = true;
+        for (int i = 0; i < size * size && reachedSame; ++i) {
+            reachedSame = reached.get(i % size, i / size) == (expected[i] != BitFlood::UNREACHABLE);
+        }
+        std::cout << "  BitFlood reachable, " << BitFlood::kernelName(kernel) << ": " << ms << " ms (x" << bfsMs / ms << ")"
+                  << (reachedSame ? "" : "  MISMATCH") << "\n";
+        same = same && reachedSame;
+    }
+    return same;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int size = argc > 1 ? std::atoi(argv[1]) : 4096;
+    int sources = argc > 2 ? std::atoi(argv[2]) : 10;
+    int repeats = argc > 3 ? std::atoi(argv[3]) : 3;
+
+    bool same = run("open field, 10% walls", makeOpenField(size, 10, 1), size, sources, repeats);
+    same = run("open field, 30% walls", makeOpenField(size, 30, 2), size, sources, repeats) && same;
+    same = run("open field, 10% walls, a row of sources", makeOpenField(size, 10, 1), size, 0, repeats) && same;
+    int mazeSize = std::max(std::min(size, 1023) | 1, 3);  // mazes need an odd size, with a cell inside the walls
+    same = run("maze", makeMaze(mazeSize, 3), mazeSize, sources, repeats) && same;
+    return same ? 0 : 1;
+}
@@ -0,0 +1,167 @@
+// Board storage benchmark: the flat Board against the old nested-vector layout.
+// usage: BoardBench [size=1000] [rounds=5]
+
+#include "Board.h"
+#include "BenchTiming.h"
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+// the Board storage as it was before the flat grid (vector per row, vector per cell)
+class LegacyBoard {
+public:
+    LegacyBoard(int w, int h) : width_(w), height_(h) {
+        grid.resize(height_, std::vector<std::vector<GameObject*>>(width_));
+    }
+    void addGameObject(GameObject* obj, Position pos) {
+        pos.wrap(width_, height_);
+        grid[pos.getY()][pos.getX()].push_back(obj);
+    }
+    const std::vector<GameObject*>& getObjectsAt(Position pos) const {
+        pos.wrap(width_, height_);
+        return grid[pos.getY()][pos.getX()];
+    }
+    void removeObject(GameObject* objToRemove, Position pos) {
+        pos.wrap(width_, height_);
+        auto& cell = grid[pos.getY()][pos.getX()];
+        cell.erase(std::remove(cell.begin(), cell.end(), objToRemove), cell.end());
+    }
+    size_t approxBytes() const {
+        size_t bytes = grid.capacity() * sizeof(grid[0]);
+        for (const auto& row : grid) {
+            bytes += row.capacity() * sizeof(row[0]);
+            for (const auto& cell : row) bytes += cell.capacity() * sizeof(GameObject*);
+        }
+        return bytes;
+    }
+private:
+    int width_, height_;
+    std::vector<std::vector<std::vector<GameObject*>>> grid;
+};
+
+struct Map {
+    std::vector<std::unique_ptr<Wall>> walls;
+    std::vector<std::unique_ptr<Mine>> mines;
+    std::vector<std::unique_ptr<Tank>> tanks;
+    std::vector<std::unique_ptr<Shell>> shells;
+};
+
+Map makeMap(int size) {
+    Map map;
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> roll(0, 999);
+    int tankId = 0;
+    for (int y = 0; y < size; ++y) {
+        for (int x = 0; x < size; ++x) {
+            int r = roll(rng);
+            Position pos(x, y);
+            if (r < 100) map.walls.push_back(std::make_unique<Wall>(pos));
+            else if (r < 110) map.mines.push_back(std::make_unique<Mine>(pos));
+            else if (r < 112) map.tanks.push_back(std::make_unique<Tank>(pos, Direction::Left, 1 + (r & 1), ++tankId));
+            else if (r < 122) map.shells.push_back(std::make_unique<Shell>(pos, Direction::Right, 0));
+        }
+    }
+    return map;
+}
+
+template<typename B>
+void fill(B& board, const Map& map) {
+    for (const auto& w : map.walls) board.addGameObject(w.get(), w->getPosition());
+    for (const auto& m : map.mines) board.addGameObject(m.get(), m->getPosition());
+    for (const auto& t : map.tanks) board.addGameObject(t.get(), t->getPosition());
+    for (const auto& s : map.shells) board.addGameObject(s.get(), s->getPosition());
+}
+
+volatile long sink = 0;
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int size = argc > 1 ? std::atoi(argv[1]) : 1000;
+    int rounds = argc > 2 ? std::atoi(argv[2]) : 5;
+
+    Map map = makeMap(size);
+    std::cout << "Board " << size << "x" << size << ": " << map.walls.size() << " walls, "
+              << map.mines.size() << " mines, " << map.tanks.size() << " tanks, "
+              << map.shells.size() << " shells\n";
+
+    std::unique_ptr<LegacyBoard> legacy;
+    std::unique_ptr<Board> flat;
+    double legacyBuild = timeMs([&] { legacy = std::make_unique<LegacyBoard>(size, size); fill(*legacy, map); });
+    double flatBuild = timeMs([&] { flat = std::make_unique<Board>(size, size); fill(*flat, map); });
+
+    // rasterization pattern: visit every cell and read its top object
+    double legacyScan = timeMs([&] {
+        for (int r = 0; r < rounds; ++r)
+            for (int y = 0; y < size; ++y)
+                for (int x = 0; x < size; ++x) {
+                    const auto& objects = legacy->getObjectsAt({x, y});
+                    if (!objects.empty()) sink += objects.front()->getSymbol();
+                }
+    });
+    double flatScan = timeMs([&] {
+        for (int r = 0; r < rounds; ++r)
+            for (int y = 0; y < size; ++y)
+                for (int x = 0; x < size; ++x) {
+                    const auto& objects = flat->getObjectsAt({x, y});
+                    if (!objects.empty()) sink += objects.front()->getSymbol();
+                }
+    });
+
+    // movement pattern: random "is there a wall in the next cell" checks
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> coord(0, size - 1);
+    std::vector<Position> probes(1 << 20);
+    for (auto& p : probes) p = Position(coord(rng), coord(rng));
+
+    double legacyProbe = timeMs([&] {
+        for (int r = 0; r < rounds; ++r)
+            for (const auto& p : probes)
+                for (GameObject* obj : legacy->getObjectsAt(p))
+                    if (dynamic_cast<Wall*>(obj)) { ++sink; break; }
+    });
+    double flatProbe = timeMs([&] {
+        for (int r = 0; r < rounds; ++r)
+            for (const auto& p : probes)
+                if (flat->isWall(p)) ++sink;
+    });
+
+    // shells hopping one cell right: remove + add
+    double legacyMove = timeMs([&] {
+        for (int r = 0; r < rounds; ++r)
+            for (const auto& s : map.shells) {
+                Position from(s->getPosition().getX() + r, s->getPosition().getY());
+                legacy->removeObject(s.get(), from);
+                legacy->addGameObject(s.get(), Position(from.getX() + 1, from.getY()));
+            }
+    });
+    double flatMove = timeMs([&] {
+        for (int r = 0; r < rounds; ++r)
+            for (const auto& s : map.shells) {
+                Position from(s->getPosition().getX() + r, s->getPosition().getY());
+                flat->removeObject(s.get(), from);
+                flat->addGameObject(s.get(), Position(from.getX() + 1, from.getY()));
+            }
+    });
+
+    size_t cells = static_cast<size_t>(size) * size;
+    size_t flatBytes = cells * (sizeof(GameObject*) + 2);
+
+    auto row = [](const std::string& name, double legacyMs, double flatMs) {
+        std::cout << "  " << name << ": legacy " << legacyMs << " ms, flat " << flatMs
+                  << " ms (x" << (flatMs > 0 ? legacyMs / flatMs : 0) << ")\n";
+    };
+    row("build         ", legacyBuild, flatBuild);
+    row("full scan     ", legacyScan, flatScan);
+    row("wall probes   ", legacyProbe, flatProbe);
+    row("shell moves   ", legacyMove, flatMove);
+    std::cout << "  memory: legacy ~" << legacy->approxBytes() / (1024 * 1024) << " MB, flat ~"
+              << flatBytes / (1024 * 1024) << " MB (+ side table)\n";
+    return 0;
+}
@@ -0,0 +1,107 @@
+// Fire matrix benchmark: "which tanks can I shoot (and which can shoot me) along my 8 lines",
+// answered by every tank walking its 8 rays to the first tank or wall, and by one FireMatrix per
+// step (tanks bucketed and sorted per line, the walls between neighbours from the LineOfFire).
+// every step a few walls are shot down, as in a game. both must find the same tanks.
+// usage: FireMatrixBench [board size=1000] [tanks=1000] [steps=20] [wall %=2]
+// exits with 1 if the two disagree.
+
+#include "FireContext.h"
+#include "BenchTiming.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace {
+
+bool isTank(char c) { return c == '1' || c == '2'; }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int size = argc > 1 ? std::atoi(argv[1]) : 1000;
+    int tankCount = argc > 2 ? std::atoi(argv[2]) : 1000;
+    int steps = argc > 3 ? std::atoi(argv[3]) : 20;
+    int wallPercent = argc > 4 ? std::atoi(argv[4]) : 2;
+
+    std::mt19937 rng(41);
+    std::uniform_int_distribution<int> roll(0, 99);
+    std::uniform_int_distribution<int> coord(0, size - 1);
+    std::vector<char> cells(static_cast<size_t>(size) * size, ' ');
+    for (char& c : cells) c = roll(rng) < wallPercent ? '#' : ' ';
+    // no more tanks than there are free cells for them
+    tankCount = std::min(tankCount, static_cast<int>(std::count(cells.begin(), cells.end(), ' ')));
+    for (int placed = 0; placed < tankCount;) {
+        char& c = cells[coord(rng) * size + coord(rng)];
+        if (c != ' ') continue;
+        c = placed++ % 2 ? '2' : '1';
+    }
+    Topology topology(size, size);
+
+    std::cout << size << "x" << size << " board, " << wallPercent << "% walls, " << tankCount << " tanks, "
+              << steps << " steps\n";
+
+    // the first step builds the wall index (once a game); the steps after that only patch it
+    FireContext context;
+    auto start = std::chrono::steady_clock::now();
+    context.matrixFor(BattlefieldSnapshot(size, size, cells, 0));
+    std::cout << "  first step, with the wall index: " << msSince(start) << " ms\n";
+
+    double scanMs = 0, matrixMs = 0;
+    long scanPairs = 0, matrixPairs = 0;
+    bool same = true;
+    std::vector<Position> tanks;
+    for (int step = 1; step <= steps; ++step) {
+        // a few walls shot down
+        for (int shot = 0; shot < 10; ++shot) {
+            char& c = cells[coord(rng) * size + coord(rng)];
+            if (c == '#') c = ' ';
+        }
+        BattlefieldSnapshot snapshot(size, size, cells, static_cast<uint64_t>(step));
+        tanks.clear();
+        for (int y = 0; y < size; ++y)
+            for (int x = 0; x < size; ++x)
+                if (isTank(cells[y * size + x])) tanks.emplace_back(x, y);
+
+        // every tank walks its 8 rays, around the board, to the first tank or wall
+        std::vector<Position> seen(tanks.size() * DIRECTION_COUNT, Position(-1, -1));
+        start = std::chrono::steady_clock::now();
+        for (size_t t = 0; t < tanks.size(); ++t) {
+            for (int d = 0; d < DIRECTION_COUNT; ++d) {
+                Position pos = tanks[t];
+                int length = topology.rayLength(static_cast<Direction>(d));
+                for (int k = 1; k < length; ++k) {
+                    pos = topology.step(pos, static_cast<Direction>(d));
+                    char c = cells[pos.getY() * size + pos.getX()];
+                    if (c == '#') break;
+                    if (!isTank(c)) continue;
+                    seen[t * DIRECTION_COUNT + d] = pos;
+                    scanPairs++;
+                    break;
+                }
+            }
+        }
+        scanMs += msSince(start);
+
+        start = std::chrono::steady_clock::now();
+        std::shared_ptr<const FireMatrix> matrix = context.matrixFor(snapshot);
+        matrixMs += msSince(start);
+
+        // the matrix lists the tanks row by row, as they were collected here
+        for (size_t t = 0; t < tanks.size(); ++t) {
+            for (int d = 0; d < DIRECTION_COUNT; ++d) {
+                FireMatrix::Aim aim = matrix->aim(static_cast<int>(t), static_cast<Direction>(d));
+                Position found = aim.tank == FireMatrix::NONE ? Position(-1, -1) : matrix->getTanks()[aim.tank].pos;
+                matrixPairs += aim.tank != FireMatrix::NONE;
+                same = same && found == seen[t * DIRECTION_COUNT + d];
+            }
+        }
+    }
+
+    std::cout << "  every tank scans its rays: " << scanMs / steps << " ms/step, " << scanPairs / steps << " aims\n"
+              << "  one fire matrix per step:  " << matrixMs / steps << " ms/step, " << matrixPairs / steps
+              << " aims (x" << scanMs / matrixMs << ")" << (same ? "" : "  MISMATCH") << "\n";
+    return same ? 0 : 1;
+}
@@ -0,0 +1,123 @@
+// Line-of-fire benchmark: "does a shot from here get to that cell before a wall", answered
+// by walking the cells in between (what ZoneControlAlgo did) and by a LineOfFire lookup.
+// Then the cost of keeping the index in step with the walls: a local patch per wall that
+// appears or is shot down, against building it again. every answer must agree with the walk,
+// and the patched index with a fresh build.
+// usage: LineOfFireBench [board size=1000] [queries=1000000] [wall changes=1000] [wall %=10]
+// exits with 1 if a lookup or the patched index disagrees.
+
+#include "LineOfFire.h"
+#include "BenchTiming.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace {
+
+struct Query {
+    Position from;
+    Direction dir;
+    Position target;
+    int steps;
+};
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int size = argc > 1 ? std::atoi(argv[1]) : 1000;
+    int queryCount = argc > 2 ? std::atoi(argv[2]) : 1000000;
+    int changes = argc > 3 ? std::atoi(argv[3]) : 1000;
+    int wallPercent = argc > 4 ? std::atoi(argv[4]) : 10;
+
+    Topology topology(size, size);
+    std::mt19937 rng(23);
+    std::uniform_int_distribution<int> roll(0, 99);
+    std::vector<uint8_t> walls(static_cast<size_t>(size) * size);
+    for (uint8_t& w : walls) w = roll(rng) < wallPercent;
+
+    // targets somewhere along one of the 8 lines from a random cell, up to half a board away
+    std::uniform_int_distribution<int> coord(0, size - 1);
+    std::uniform_int_distribution<int> dir(0, DIRECTION_COUNT - 1);
+    std::uniform_int_distribution<int> reach(1, std::max(size / 2, 1));
+    std::vector<Query> queries(queryCount);
+    for (Query& q : queries) {
+        q.from = Position(coord(rng), coord(rng));
+        q.dir = static_cast<Direction>(dir(rng));
+        q.steps = reach(rng);
+        int d = static_cast<int>(q.dir);
+        q.target = Position(((q.from.getX() + DIRECTION_DX[d] * q.steps) % size + size) % size,
+                            ((q.from.getY() + DIRECTION_DY[d] * q.steps) % size + size) % size);
+    }
+
+    std::cout << size << "x" << size << " board, " << wallPercent << "% walls\n";
+
+    auto start = std::chrono::steady_clock::now();
+    LineOfFire lineOfFire;
+    lineOfFire.build(topology, walls.data());
+    double buildMs = msSince(start);
+    std::cout << "  build: " << buildMs << " ms\n";
+
+    // the walk knows how far along the line the target is, as the old row/column scans did
+    std::vector<uint8_t> walked(queryCount), looked(queryCount);
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < queryCount; ++i) {
+        const Query& q = queries[i];
+        Position p = q.from;
+        bool clear = true;
+        for (int k = 0; k < q.steps && clear; ++k) {
+            p = topology.step(p, q.dir);
+            clear = walls[topology.indexOf(p)] == 0;
+        }
+        walked[i] = clear;
+    }
+    double walkMs = msSince(start);
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < queryCount; ++i) {
+        const Query& q = queries[i];
+        looked[i] = lineOfFire.canHit(q.from, q.dir, q.target);
+    }
+    double lookupMs = msSince(start);
+
+    // the same line can come around to a target sooner than the way it was placed (on a small
+    // board): then the walk, which went the long way, may disagree - count only the others
+    long disagree = 0, hits = 0;
+    for (int i = 0; i < queryCount; ++i) {
+        const Query& q = queries[i];
+        if (topology.stepsAlong(q.from, q.dir, q.target) != q.steps) continue;
+        disagree += walked[i] != looked[i];
+        hits += looked[i];
+    }
+    std::cout << "  " << queryCount << " queries (" << hits << " clear):\n"
+              << "    walk the cells: " << walkMs << " ms, " << queryCount / (walkMs / 1000.0) << " queries/s\n"
+              << "    LineOfFire:     " << lookupMs << " ms, " << queryCount / (lookupMs / 1000.0)
+              << " queries/s (x" << walkMs / lookupMs << ")" << (disagree ? "  MISMATCH" : "") << "\n";
+
+    // walls appearing and being shot down, one at a time
+    std::vector<int> flips(changes);
+    std::uniform_int_distribution<int> cell(0, size * size - 1);
+    for (int& c : flips) c = cell(rng);
+    start = std::chrono::steady_clock::now();
+    for (int c : flips) {
+        walls[c] ^= 1;
+        lineOfFire.wallChanged(walls.data(), c);
+    }
+    double patchMs = msSince(start);
+
+    LineOfFire fresh;
+    fresh.build(topology, walls.data());
+    bool same = true;
+    for (int c = 0; c < size * size && same; ++c) {
+        for (int d = 0; d < DIRECTION_COUNT && same; ++d) {
+            Position p = topology.positionOf(c);
+            same = lineOfFire.clearCells(p, static_cast<Direction>(d)) == fresh.clearCells(p, static_cast<Direction>(d));
+        }
+    }
+    std::cout << "  " << changes << " wall changes: " << patchMs << " ms patched ("
+              << patchMs * 1000.0 / std::max(changes, 1) << " us each), a rebuild each would be "
+              << buildMs * changes << " ms" << (same ? "" : "  PATCH DIFFERS") << "\n";
+    return disagree == 0 && same ? 0 : 1;
+}
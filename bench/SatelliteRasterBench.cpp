@@ -0,0 +1,127 @@
+// Satellite view benchmark: a full rasterization of the board every step (BattlefieldSnapshot::capture)
+// against SatelliteRaster, which follows the board's change events and redraws only what changed.
+// Every step the tanks move one cell, some of them fire, the shells fly two cells and may hit
+// walls - then one snapshot is taken, as on a step where some tank asks for battle info.
+// usage: SatelliteRasterBench [board size=2000] [tanks=20] [steps=200]
+// exits with 1 if the two rasterizations differ.
+
+#include "Board.h"
+#include "BattlefieldSnapshot.h"
+#include "SatelliteRaster.h"
+#include "ShellPool.h"
+#include "BenchTiming.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace {
+
+struct World {
+    Board board;
+    std::vector<std::unique_ptr<Wall>> walls;
+    std::vector<std::unique_ptr<Tank>> tanks;
+    ShellPool shells;
+
+    World(int size, int tankCount) : board(size, size) {
+        std::mt19937 rng(4);
+        std::uniform_int_distribution<int> roll(0, 99);
+        for (int y = 0; y < size; ++y)
+            for (int x = 0; x < size; ++x)
+                if (roll(rng) < 2) {
+                    walls.push_back(std::make_unique<Wall>(Position(x, y)));
+                    board.addGameObject(walls.back().get(), walls.back()->getPosition());
+                }
+        std::uniform_int_distribution<int> coord(0, size - 1);
+        for (int i = 0; i < tankCount; ++i) {
+            Position pos(coord(rng), coord(rng));
+            tanks.push_back(std::make_unique<Tank>(pos, Direction::Right, 1 + i % 2, i));
+            board.addGameObject(tanks.back().get(), pos);
+        }
+    }
+
+    // the same moves for both runs (same seed)
+    void step(std::mt19937& rng) {
+        int size = board.getWidth();
+        std::uniform_int_distribution<int> dir(0, DIRECTION_COUNT - 1);
+        std::uniform_int_distribution<int> roll(0, 9);
+        for (auto& t : tanks) {
+            Position from = t->getPosition();
+            Direction d = static_cast<Direction>(dir(rng));
+            Position to(from.getX() + DIRECTION_DX[static_cast<int>(d)], from.getY() + DIRECTION_DY[static_cast<int>(d)]);
+            to.wrap(size, size);
+            if (board.isWall(to)) continue;
+            t->setPosition(to);
+            board.moveObject(t.get(), from, to);
+            if (roll(rng) == 0) {
+                shells.spawn(to, d, t->getId());
+                board.addShell(to);
+            }
+        }
+        for (int half = 0; half < 2; ++half) {
+            for (int slot = 0; slot < shells.slotCount(); ++slot) {
+                if (!shells.isAlive(slot)) continue;
+                Position from = shells.getPosition(slot);
+                shells.advance(slot, size, size);
+                Position to = shells.getPosition(slot);
+                board.moveShell(from, to);
+                if (board.isWall(to)) {
+                    for (GameObject* obj : board.getObjectsAt(to)) {
+                        if (obj->getKind() != ObjectKind::Wall || obj->isDestroyed()) continue;
+                        if (board.hitWall(*static_cast<Wall*>(obj))) board.removeObject(obj, to);
+                        break;
+                    }
+                    shells.destroy(slot);
+                }
+            }
+            shells.releaseDestroyed([&](int slot) { board.removeShell(shells.getPosition(slot)); });
+        }
+    }
+};
+
+template<typename Snap>
+double run(int size, int tankCount, int steps, Snap&& snap, long& checksum) {
+    World world(size, tankCount);
+    auto takeSnapshot = snap(world.board);
+    std::mt19937 rng(9);
+    std::vector<std::shared_ptr<const BattlefieldSnapshot>> held;  // algorithms keep older snapshots alive
+
+    auto start = std::chrono::steady_clock::now();
+    for (int step = 0; step < steps; ++step) {
+        world.step(rng);
+        auto snapshot = takeSnapshot();
+        for (auto& t : world.tanks) checksum += snapshot->getObjectAt(t->getPosition().getX(), t->getPosition().getY());
+        held.push_back(snapshot);
+        if (held.size() > 4) held.erase(held.begin());
+    }
+    return msSince(start);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int size = argc > 1 ? std::atoi(argv[1]) : 2000;
+    int tankCount = argc > 2 ? std::atoi(argv[2]) : 20;
+    int steps = argc > 3 ? std::atoi(argv[3]) : 200;
+
+    std::cout << size << "x" << size << " board, " << tankCount << " tanks, " << steps << " steps\n";
+
+    long fullSum = 0, rasterSum = 0;
+    double fullMs = run(size, tankCount, steps, [](Board& board) {
+        return [&board] { return BattlefieldSnapshot::capture(board); };
+    }, fullSum);
+    std::cout << "  full rasterization: " << fullMs / steps << " ms/step\n";
+
+    std::unique_ptr<SatelliteRaster> raster;
+    double rasterMs = run(size, tankCount, steps, [&raster](Board& board) {
+        raster = std::make_unique<SatelliteRaster>(board);
+        board.setObserver(raster.get());
+        return [&raster] { return raster->snapshot(); };
+    }, rasterSum);
+    std::cout << "  incremental raster: " << rasterMs / steps << " ms/step (x" << fullMs / rasterMs << ")"
+              << (fullSum == rasterSum ? "" : "  MISMATCH") << "\n";
+    return fullSum == rasterSum ? 0 : 1;
+}
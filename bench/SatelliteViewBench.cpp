@@ -0,0 +1,63 @@
+// Satellite view read benchmark: reading a whole view cell by cell through the virtual
+// SatelliteView::getObjectAt, against the BulkSatelliteView row and region access.
+// usage: SatelliteViewBench [board size=2000] [reads=20]
+// exits with 1 if the reads differ.
+
+#include "SatelliteViewImpl.h"
+#include "BenchTiming.h"
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace {
+
+std::shared_ptr<const BattlefieldSnapshot> makeSnapshot(size_t size) {
+    const char symbols[] = {' ', ' ', ' ', ' ', ' ', ' ', '#', '@', '*', '1', '2'};
+    std::mt19937 rng(6);
+    std::uniform_int_distribution<int> pick(0, sizeof(symbols) - 1);
+    std::vector<char> cells(size * size);
+    for (char& c : cells) c = symbols[pick(rng)];
+    return std::make_shared<const BattlefieldSnapshot>(size, size, std::move(cells));
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t size = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 2000;
+    int reads = argc > 2 ? std::atoi(argv[2]) : 20;
+
+    SatelliteViewImpl impl(makeSnapshot(size), {size / 2, size / 2});
+    const SatelliteView& view = impl;
+    const BulkSatelliteView& bulk = impl;
+    long perCellSum = 0, rowSum = 0, regionSum = 0;
+
+    double perCellMs = timeMs([&] {
+        for (int r = 0; r < reads; ++r)
+            for (size_t y = 0; y < size; ++y)
+                for (size_t x = 0; x < size; ++x) perCellSum += view.getObjectAt(x, y);
+    });
+    double rowMs = timeMs([&] {
+        for (int r = 0; r < reads; ++r)
+            for (size_t y = 0; y < size; ++y) {
+                const char* row = bulk.getRow(y);
+                for (size_t x = 0; x < size; ++x) rowSum += row[x];
+            }
+    });
+    std::vector<char> region(size * size);
+    double regionMs = timeMs([&] {
+        for (int r = 0; r < reads; ++r) {
+            bulk.copyRegion(0, 0, size, size, region.data());
+            for (char c : region) regionSum += c;
+        }
+    });
+
+    double cells = static_cast<double>(size) * size * reads;
+    std::cout << size << "x" << size << " view, " << reads << " full reads\n";
+    std::cout << "  getObjectAt per cell: " << perCellMs << " ms (" << perCellMs * 1e6 / cells << " ns/cell)\n";
+    std::cout << "  getRow:               " << rowMs << " ms (" << rowMs * 1e6 / cells << " ns/cell, x"
+              << perCellMs / rowMs << ")" << (rowSum == perCellSum ? "" : "  MISMATCH") << "\n";
+    std::cout << "  copyRegion:           " << regionMs << " ms (" << regionMs * 1e6 / cells << " ns/cell, x"
+              << perCellMs / regionMs << ")" << (regionSum == perCellSum ? "" : "  MISMATCH") << "\n";
+    return rowSum == perCellSum && regionSum == perCellSum ? 0 : 1;
+}
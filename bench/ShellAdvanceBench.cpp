@@ -0,0 +1,75 @@
+// Shell advance benchmark: the ShellAdvance kernels against the old one-Shell-at-a-time path
+// (virtual Shell::moveForward, switch on the direction, Position::wrap with two modulos).
+// usage: ShellAdvanceBench [shells=100000] [half-steps=1000] [board size=1000]
+// exits with 1 if a kernel ends a shell somewhere else.
+
+#include "Shell.h"
+#include "ShellAdvance.h"
+#include "BenchTiming.h"
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+int main(int argc, char** argv) {
+    int count = argc > 1 ? std::atoi(argv[1]) : 100000;
+    int halfSteps = argc > 2 ? std::atoi(argv[2]) : 1000;
+    int size = argc > 3 ? std::atoi(argv[3]) : 1000;
+
+    std::mt19937 rng(5);
+    std::uniform_int_distribution<int> coord(0, size - 1);
+    std::uniform_int_distribution<int> dir(0, DIRECTION_COUNT - 1);
+
+    std::vector<std::unique_ptr<Shell>> shells;
+    std::vector<int32_t> x(count), y(count), dx(count), dy(count);
+    for (int i = 0; i < count; ++i) {
+        Position pos(coord(rng), coord(rng));
+        int d = dir(rng);
+        shells.push_back(std::make_unique<Shell>(pos, static_cast<Direction>(d), 0));
+        x[i] = pos.getX();
+        y[i] = pos.getY();
+        dx[i] = DIRECTION_DX[d];
+        dy[i] = DIRECTION_DY[d];
+    }
+
+    std::cout << count << " shells, " << halfSteps << " half-steps, " << size << "x" << size << " board\n";
+
+    double legacyMs = timeMs([&] {
+        for (int step = 0; step < halfSteps; ++step) {
+            for (auto& shell : shells) {
+                shell->moveForward();
+                Position newPos = shell->getPosition();
+                newPos.wrap(size, size);
+                shell->setPosition(newPos);
+            }
+        }
+    });
+    double perShell = count * static_cast<double>(halfSteps);
+    std::cout << "  virtual Shell: " << legacyMs << " ms (" << legacyMs * 1e6 / perShell << " ns/shell)\n";
+
+    const ShellAdvance::Kernel kernels[] = {ShellAdvance::Kernel::Scalar, ShellAdvance::Kernel::SSE2,
+                                            ShellAdvance::Kernel::AVX2};
+    bool allSame = true;
+    for (ShellAdvance::Kernel kernel : kernels) {
+        if (!ShellAdvance::isSupported(kernel)) continue;
+        std::vector<int32_t> kx = x, ky = y;
+        double ms = timeMs([&] {
+            for (int step = 0; step < halfSteps; ++step)
+                ShellAdvance::advance(kx.data(), ky.data(), dx.data(), dy.data(), count, size, size, kernel);
+        });
+
+        // every kernel must end where the per-object path ended
+        bool same = true;
+        for (int i = 0; i < count; ++i) {
+            Position p = shells[i]->getPosition();
+            if (p.getX() != kx[i] || p.getY() != ky[i]) { same = false; break; }
+        }
+        std::cout << "  " << ShellAdvance::kernelName(kernel) << " kernel: " << ms << " ms ("
+                  << ms * 1e6 / perShell << " ns/shell, x" << legacyMs / ms << ")"
+                  << (same ? "" : "  MISMATCH") << "\n";
+        allSame = allSame && same;
+    }
+    std::cout << "  runtime pick: " << ShellAdvance::kernelName(ShellAdvance::bestKernel()) << "\n";
+    return allSame ? 0 : 1;
+}
@@ -0,0 +1,112 @@
+// Shell vs shell collisions: a corpus of head-on, diagonal and wrap-around cases checked
+// against ShellCollisionFinder, then the finder timed on a crowded board.
+// Each case runs one half-step the way GameManager::shellStep does: crossings before the
+// move, the move, then shared cells among the shells that survived the crossings.
+// usage: ShellCollisionBench [shells=100000] [half-steps=100] [board size=1000]
+// exits with 1 if a corpus case fails.
+
+#include "ShellPool.h"
+#include "ShellCollisionFinder.h"
+#include "BenchTiming.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace {
+
+struct ShellSpec {
+    int x, y;
+    Direction dir;
+};
+
+struct Case {
+    const char* name;
+    std::vector<ShellSpec> shells;
+    std::vector<int> expectedHits;  // indexes into shells, sorted
+};
+
+const int CORPUS_BOARD = 10;
+
+const std::vector<Case> CORPUS = {
+    {"head-on, adjacent (swap)",            {{3, 5, Direction::Right}, {4, 5, Direction::Left}},          {0, 1}},
+    {"head-on, one cell apart",             {{3, 5, Direction::Right}, {5, 5, Direction::Left}},          {0, 1}},
+    {"head-on vertical, adjacent",          {{2, 2, Direction::Down}, {2, 3, Direction::Up}},              {0, 1}},
+    {"head-on across the left edge",        {{0, 5, Direction::Left}, {9, 5, Direction::Right}},          {0, 1}},
+    {"head-on across the top edge",         {{4, 0, Direction::Up}, {4, 9, Direction::Down}},              {0, 1}},
+    {"chasing, same direction",             {{3, 5, Direction::Right}, {4, 5, Direction::Right}},         {}},
+    {"diagonals crossing in a 2x2 block",   {{3, 3, Direction::DownRight}, {4, 3, Direction::DownLeft}},  {0, 1}},
+    {"diagonals crossing, other pair",      {{3, 4, Direction::UpRight}, {4, 4, Direction::UpLeft}},      {0, 1}},
+    {"diagonal head-on (swap)",             {{3, 3, Direction::DownRight}, {4, 4, Direction::UpLeft}},    {0, 1}},
+    {"diagonals crossing at the corner",    {{9, 9, Direction::DownRight}, {0, 9, Direction::DownLeft}},  {0, 1}},
+    {"parallel diagonals",                  {{3, 3, Direction::DownRight}, {4, 3, Direction::DownRight}}, {}},
+    {"diagonals diverging",                 {{3, 3, Direction::DownLeft}, {4, 3, Direction::DownRight}},  {}},
+    {"diagonals meeting in a cell",         {{3, 3, Direction::DownRight}, {5, 3, Direction::DownLeft}},  {0, 1}},
+    {"diagonals missing by one cell",       {{3, 3, Direction::DownRight}, {6, 3, Direction::DownLeft}},  {}},
+    {"perpendicular, same target cell",     {{3, 3, Direction::Right}, {4, 2, Direction::Down}},           {0, 1}},
+    {"perpendicular, passing behind",       {{3, 3, Direction::Right}, {5, 2, Direction::Down}},           {}},
+    {"diagonal vs orthogonal, no cross",    {{3, 3, Direction::DownRight}, {4, 3, Direction::Left}},       {}},
+    {"three into one cell",                 {{4, 4, Direction::Right}, {6, 4, Direction::Left}, {5, 3, Direction::Down}}, {0, 1, 2}},
+    {"crossing pair + bystander in target", {{3, 5, Direction::Right}, {4, 5, Direction::Left}, {4, 4, Direction::Down}}, {0, 1}},
+};
+
+// one half-step, as in GameManager::shellStep (without the board)
+std::vector<int> halfStep(ShellPool& pool, int width, int height, ShellCollisionFinder& finder) {
+    std::vector<int> crossed = finder.findCrossings(pool, width, height);
+    pool.advanceAll(width, height);
+    std::vector<int> hits = crossed;
+    for (int slot : crossed) pool.destroy(slot);
+    for (int slot : finder.findSharedCells(pool, width)) hits.push_back(slot);
+    for (int slot : hits) pool.destroy(slot);
+    pool.releaseDestroyed([](int) {});
+    return hits;
+}
+
+bool runCorpus() {
+    bool allPassed = true;
+    ShellCollisionFinder finder;
+    for (const Case& c : CORPUS) {
+        ShellPool pool;
+        for (const ShellSpec& s : c.shells) pool.spawn(Position(s.x, s.y), s.dir, 0);
+
+        std::vector<int> hits = halfStep(pool, CORPUS_BOARD, CORPUS_BOARD, finder);
+        std::sort(hits.begin(), hits.end());  // slots == indexes, the pool was empty
+        bool passed = hits == c.expectedHits;
+        allPassed = allPassed && passed;
+        std::cout << "  " << (passed ? "ok  " : "FAIL") << "  " << c.name << "\n";
+    }
+    return allPassed;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int count = argc > 1 ? std::atoi(argv[1]) : 100000;
+    int halfSteps = argc > 2 ? std::atoi(argv[2]) : 100;
+    int size = argc > 3 ? std::atoi(argv[3]) : 1000;
+
+    std::cout << "corpus (" << CORPUS.size() << " cases, " << CORPUS_BOARD << "x" << CORPUS_BOARD << " board):\n";
+    bool passed = runCorpus();
+
+    std::mt19937 rng(11);
+    std::uniform_int_distribution<int> coord(0, size - 1);
+    std::uniform_int_distribution<int> dir(0, DIRECTION_COUNT - 1);
+    ShellPool pool;
+    ShellCollisionFinder finder;
+    long collided = 0, checked = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int step = 0; step < halfSteps; ++step) {
+        while (pool.getLiveCount() < count) pool.spawn(Position(coord(rng), coord(rng)), static_cast<Direction>(dir(rng)), 0);
+        checked += pool.getLiveCount();
+        collided += static_cast<long>(halfStep(pool, size, size, finder).size());
+    }
+    double ms = msSince(start);
+
+    std::cout << count << " shells, " << halfSteps << " half-steps, " << size << "x" << size << " board: "
+              << ms << " ms, " << static_cast<long>(checked / (ms / 1000.0)) << " shells checked/s, "
+              << collided << " collisions\n";
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,149 @@
+// Shell storage benchmark: ShellPool (parallel arrays + free list) against one heap Shell per shot.
+// Every half-step fires new shells, advances all shells one cell, collides them with walls
+// and with each other, and cleans up the destroyed ones - the same work as GameManager::shellStep.
+// usage: ShellPoolBench [shells in flight=100000] [half-steps=200] [board size=1000]
+
+#include "Board.h"
+#include "ShellPool.h"
+#include "BenchTiming.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace {
+
+struct Shot {
+    Position pos;
+    Direction dir;
+};
+
+struct Result {
+    double ms = 0;
+    long advanced = 0;
+    long collided = 0;
+};
+
+std::vector<Shot> makeShots(int count, int size, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> coord(0, size - 1);
+    std::uniform_int_distribution<int> dir(0, DIRECTION_COUNT - 1);
+    std::vector<Shot> shots(count);
+    for (auto& s : shots) s = {Position(coord(rng), coord(rng)), static_cast<Direction>(dir(rng))};
+    return shots;
+}
+
+void addWalls(Board& board, std::vector<std::unique_ptr<Wall>>& walls, int size) {
+    std::mt19937 rng(1);
+    std::uniform_int_distribution<int> roll(0, 99);
+    for (int y = 0; y < size; ++y)
+        for (int x = 0; x < size; ++x)
+            if (roll(rng) < 2) {
+                walls.push_back(std::make_unique<Wall>(Position(x, y)));
+                board.addGameObject(walls.back().get(), walls.back()->getPosition());
+            }
+}
+
+// the storage the game manager used before the pool
+Result runHeapShells(int inFlight, int halfSteps, int size) {
+    Board board(size, size);
+    std::vector<std::unique_ptr<Wall>> walls;
+    addWalls(board, walls, size);
+    std::vector<std::unique_ptr<Shell>> shells;
+    std::vector<Shot> refill = makeShots(inFlight, size, 3);
+    size_t next = 0;
+    Result r;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int step = 0; step < halfSteps; ++step) {
+        while (static_cast<int>(shells.size()) < inFlight) {
+            const Shot& s = refill[next++ % refill.size()];
+            shells.push_back(std::make_unique<Shell>(s.pos, s.dir, 1));
+            board.addGameObject(shells.back().get(), s.pos);
+        }
+        for (auto& shell : shells) {
+            Position oldPos = shell->getPosition();
+            shell->moveForward();
+            Position newPos = shell->getPosition();
+            newPos.wrap(size, size);
+            shell->setPosition(newPos);
+            board.moveObject(shell.get(), oldPos, newPos);
+        }
+        r.advanced += static_cast<long>(shells.size());
+        for (auto& shell : shells) {
+            for (GameObject* obj : board.getObjectsAt(shell->getPosition())) {
+                if (obj != shell.get() && obj->getKind() != ObjectKind::Mine) { shell->destroy(); break; }
+            }
+        }
+        shells.erase(std::remove_if(shells.begin(), shells.end(), [&](std::unique_ptr<Shell>& s) {
+            if (!s->isDestroyed()) return false;
+            board.removeObject(s.get(), s->getPosition());
+            r.collided++;
+            return true;
+        }), shells.end());
+    }
+    r.ms = msSince(start);
+    return r;
+}
+
+Result runShellPool(int inFlight, int halfSteps, int size) {
+    Board board(size, size);
+    std::vector<std::unique_ptr<Wall>> walls;
+    addWalls(board, walls, size);
+    ShellPool pool;
+    std::vector<Shot> refill = makeShots(inFlight, size, 3);
+    size_t next = 0;
+    Result r;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int step = 0; step < halfSteps; ++step) {
+        while (pool.getLiveCount() < inFlight) {
+            const Shot& s = refill[next++ % refill.size()];
+            pool.spawn(s.pos, s.dir, 1);
+            board.addShell(s.pos);
+        }
+        for (int slot = 0; slot < pool.slotCount(); ++slot) {
+            if (!pool.isAlive(slot)) continue;
+            Position oldPos = pool.getPosition(slot);
+            pool.advance(slot, size, size);
+            board.moveShell(oldPos, pool.getPosition(slot));
+        }
+        r.advanced += pool.getLiveCount();
+        for (int slot = 0; slot < pool.slotCount(); ++slot) {
+            if (!pool.isAlive(slot)) continue;
+            Position pos = pool.getPosition(slot);
+            if (board.isWall(pos) || board.getShellCount(pos) > 1) pool.destroy(slot);
+        }
+        pool.releaseDestroyed([&](int slot) {
+            board.removeShell(pool.getPosition(slot));
+            r.collided++;
+        });
+        if (pool.isSparse()) pool.compact();
+    }
+    r.ms = msSince(start);
+    return r;
+}
+
+void report(const char* name, const Result& r) {
+    double seconds = r.ms / 1000.0;
+    std::cout << "  " << name << ": " << r.ms << " ms, "
+              << static_cast<long>(r.advanced / seconds) << " shells advanced/s, "
+              << static_cast<long>(r.collided / seconds) << " shells collided/s\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int inFlight = argc > 1 ? std::atoi(argv[1]) : 100000;
+    int halfSteps = argc > 2 ? std::atoi(argv[2]) : 200;
+    int size = argc > 3 ? std::atoi(argv[3]) : 1000;
+
+    std::cout << inFlight << " shells in flight, " << halfSteps << " half-steps, "
+              << size << "x" << size << " board\n";
+    report("heap shells", runHeapShells(inFlight, halfSteps, size));
+    report("shell pool ", runShellPool(inFlight, halfSteps, size));
+    return 0;
+}
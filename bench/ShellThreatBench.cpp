@@ -0,0 +1,107 @@
+// Shell dodging benchmark: every tank of a player asking "can a shell get to me within a few
+// steps", by looping over all the shells per tank (what ZoneControlAlgo did, same row or column
+// only) and by one ShellThreatMap per step, then a lookup per tank (all 8 lines, stopping at walls).
+// the two don't answer quite the same question, so both counts of tanks in danger are printed.
+// the map is also checked, cell by cell, against every shell walked 2 moves a step along its 8
+// lines up to the first wall.
+// usage: ShellThreatBench [board size=1000] [shells=100000] [tanks=1000] [steps=20]
+// exits with 1 if the map and the walk disagree.
+
+#include "ShellThreatMap.h"
+#include "Topology.h"
+#include "BenchTiming.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+int main(int argc, char** argv) {
+    int size = argc > 1 ? std::atoi(argv[1]) : 1000;
+    int shellCount = argc > 2 ? std::atoi(argv[2]) : 100000;
+    int tankCount = argc > 3 ? std::atoi(argv[3]) : 1000;
+    int steps = argc > 4 ? std::atoi(argv[4]) : 20;
+    const int horizon = 3;
+
+    // a few walls, the shells and the tanks on free cells
+    std::mt19937 rng(31);
+    std::uniform_int_distribution<int> roll(0, 99);
+    std::uniform_int_distribution<int> coord(0, size - 1);
+    std::vector<char> cells(static_cast<size_t>(size) * size, ' ');
+    for (char& c : cells) c = roll(rng) < 5 ? '#' : ' ';
+    // no more shells and tanks than there are free cells for them
+    int freeCells = static_cast<int>(std::count(cells.begin(), cells.end(), ' '));
+    shellCount = std::min(shellCount, freeCells);
+    tankCount = std::min(tankCount, freeCells - shellCount);
+    std::vector<Position> shells(shellCount), tanks(tankCount);
+    auto freeCell = [&](char symbol) {
+        for (;;) {
+            Position p(coord(rng), coord(rng));
+            char& c = cells[p.getY() * size + p.getX()];
+            if (c != ' ') continue;
+            c = symbol;
+            return p;
+        }
+    };
+    for (Position& s : shells) s = freeCell('*');
+    for (Position& t : tanks) t = freeCell('1');
+    BattlefieldSnapshot snapshot(size, size, cells, 1);
+    Topology topology(size, size);
+
+    std::cout << size << "x" << size << " board, " << shellCount << " shells, " << tankCount << " tanks, "
+              << steps << " steps, " << horizon << " steps ahead\n";
+
+    // per tank, every shell: in our row or column, and close enough either way
+    long loopDanger = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int step = 0; step < steps; ++step) {
+        for (const Position& t : tanks) {
+            for (const Position& s : shells) {
+                int reach = Shell::MOVES_PER_STEP * horizon;
+                if ((s.getY() == t.getY() && std::abs(topology.deltaX(s.getX(), t.getX())) <= reach) ||
+                    (s.getX() == t.getX() && std::abs(topology.deltaY(s.getY(), t.getY())) <= reach)) {
+                    loopDanger++;
+                    break;
+                }
+            }
+        }
+    }
+    double loopMs = msSince(start);
+
+    ShellThreatMap threats;
+    long mapDanger = 0;
+    start = std::chrono::steady_clock::now();
+    for (int step = 0; step < steps; ++step) {
+        threats.compute(snapshot, horizon);
+        for (const Position& t : tanks) mapDanger += threats.firstHitStep(t) != 0;
+    }
+    double mapMs = msSince(start);
+
+    // every shell walked along its 8 lines, around the board, the first step it can be in a cell
+    //(0: none within the horizon)
+    std::vector<int> walked(cells.size(), 0);
+    for (const Position& s : shells) {
+        for (int d = 0; d < DIRECTION_COUNT; ++d) {
+            Position pos = s;
+            for (int move = 0; move < Shell::MOVES_PER_STEP * horizon; ++move) {
+                pos = topology.step(pos, static_cast<Direction>(d));
+                if (cells[pos.getY() * size + pos.getX()] == '#') break;
+                int step = move / Shell::MOVES_PER_STEP + 1;
+                int& first = walked[pos.getY() * size + pos.getX()];
+                if (first == 0 || step < first) first = step;
+            }
+        }
+    }
+    bool same = true;
+    for (int y = 0; y < size; ++y)
+        for (int x = 0; x < size; ++x)
+            same = same && threats.firstHitStep(Position(x, y)) == walked[y * size + x];
+
+    std::cout << "  loop over the shells per tank: " << loopMs / steps << " ms/step, "
+              << loopDanger / steps << " tanks in danger\n"
+              << "  one threat map, a lookup each: " << mapMs / steps << " ms/step, "
+              << mapDanger / steps << " tanks in danger (x" << loopMs / mapMs << ")"
+              << (same ? "" : "  MISMATCH") << "\n";
+    return same ? 0 : 1;
+}
@@ -0,0 +1,92 @@
+// Tank state benchmark: the once-per-step counters update done tank by tank through the Tank
+// handles (the old GameManager::countersHandler) against one TankStore::updateCounters pass,
+// plus the movement work that still goes through the handles.
+// usage: TankStoreBench [tanks=10000] [steps=10000]
+// exits with 1 if the two ways leave a tank in different states.
+
+#include "Tank.h"
+#include "TankStore.h"
+#include "BenchTiming.h"
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace {
+
+// every 7th tank shoots and every 11th starts waiting to move back, so the counters stay busy
+void shootAndBack(std::vector<std::unique_ptr<Tank>>& tanks, int step) {
+    for (size_t i = 0; i < tanks.size(); ++i) {
+        if ((i + step) % 7 == 0) tanks[i]->shoot();
+        if ((i + step) % 11 == 0) tanks[i]->askToMoveBack();
+    }
+}
+
+std::vector<std::unique_ptr<Tank>> makeTanks(int count, int size, TankStore& store) {
+    std::mt19937 rng(8);
+    std::uniform_int_distribution<int> coord(0, size - 1);
+    std::vector<std::unique_ptr<Tank>> tanks;
+    for (int i = 0; i < count; ++i) {
+        tanks.push_back(std::make_unique<Tank>(Position(coord(rng), coord(rng)), Direction::Right, 1 + i % 2, i));
+        tanks.back()->attachToStore(store);
+    }
+    return tanks;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int count = argc > 1 ? std::atoi(argv[1]) : 10000;
+    int steps = argc > 2 ? std::atoi(argv[2]) : 10000;
+    const int size = 1000;
+
+    TankStore handleStore, passStore;
+    auto handleTanks = makeTanks(count, size, handleStore);
+    auto passTanks = makeTanks(count, size, passStore);
+
+    double handleMs = 0, passMs = 0;
+    for (int step = 0; step < steps; ++step) {
+        shootAndBack(handleTanks, step);
+        shootAndBack(passTanks, step);
+        handleMs += timeMs([&] {
+            for (auto& t : handleTanks) {
+                t->updateWaitToMoveBackCounter();
+                t->resetIsWaitingToMoveBack();
+                t->updateWaitAfterShootCounter();
+                t->resetIsWaitingAfterShoot();
+            }
+        });
+        passMs += timeMs([&] { passStore.updateCounters(); });
+    }
+
+    // both ways must leave every tank in the same state
+    bool same = true;
+    for (int i = 0; i < count; ++i) {
+        const Tank& a = *handleTanks[i];
+        const Tank& b = *passTanks[i];
+        if (a.getIsWaitingAfterShoot() != b.getIsWaitingAfterShoot() ||
+            a.getIsWaitingToMoveBack() != b.getIsWaitingToMoveBack() ||
+            a.getWaitToMoveBackCounter() != b.getWaitToMoveBackCounter() ||
+            a.getShellsLeft() != b.getShellsLeft()) { same = false; break; }
+    }
+
+    double moveMs = timeMs([&] {
+        for (int step = 0; step < steps; ++step) {
+            for (auto& t : passTanks) {
+                t->moveForward();
+                Position p = t->getPosition();
+                p.wrap(size, size);
+                t->setPosition(p);
+            }
+        }
+    });
+
+    double perTank = count * static_cast<double>(steps);
+    std::cout << count << " tanks, " << steps << " steps\n";
+    std::cout << "  counters, tank by tank: " << handleMs << " ms (" << handleMs * 1e6 / perTank << " ns/tank)\n";
+    std::cout << "  counters, store pass:   " << passMs << " ms (" << passMs * 1e6 / perTank << " ns/tank, x"
+              << handleMs / passMs << ")" << (same ? "" : "  MISMATCH") << "\n";
+    std::cout << "  moves through handles:  " << moveMs << " ms (" << moveMs * 1e6 / perTank << " ns/tank)\n";
+    return same ? 0 : 1;
+}
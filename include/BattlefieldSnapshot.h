@@ -0,0 +1,70 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "Position.h"
+
+class Board;
+
+// An immutable picture of the board, one char per cell, row by row.
+// It is handed around as a shared_ptr<const BattlefieldSnapshot>: the satellite view, the
+// battle info and the algorithms that keep it all point at the same rows, nobody copies them.
+// rows are shared between snapshots too - SatelliteRaster only makes new copies of the rows
+// that changed. the requesting tank's '%' is not in the rows - each view adds it as an overlay.
+// it also lists the cells of every kind of symbol, so nobody has to scan it to find things.
+class BattlefieldSnapshot {
+public:
+    using Row = std::shared_ptr<const std::vector<char>>;
+
+    enum SymbolList { WALLS, MINES, SHELLS, PLAYER1_TANKS, PLAYER2_TANKS, SYMBOL_LIST_COUNT };
+    using PositionList = std::shared_ptr<const std::vector<Position>>;  // row by row (see isBefore)
+    using SymbolLists = std::array<PositionList, SYMBOL_LIST_COUNT>;
+
+    static constexpr char EMPTY = ' ';
+    static constexpr char OUT_OF_BOUNDS = '&';
+    static constexpr char SELF = '%';
+
+    // sequence: which picture of the board this is (SatelliteRaster counts from 1; 0 = not counted)
+    // one row-major buffer - the symbol lists are built from it (O(cells))
+    BattlefieldSnapshot(size_t width, size_t height, std::vector<char> cells, uint64_t sequence = 0);
+    // one buffer per row, with the symbol lists that match them
+    BattlefieldSnapshot(size_t width, size_t height, std::vector<Row> rows, SymbolLists lists, uint64_t sequence = 0);
+
+    // the whole board, O(cells)
+    static std::shared_ptr<const BattlefieldSnapshot> capture(const Board& board);
+    // the symbol of the top object of a cell ('*' for a cell with only shells)
+    static char symbolAt(const Board& board, Position pos);
+
+    char getObjectAt(size_t x, size_t y) const {
+        if (x >= width_ || y >= height_) return OUT_OF_BOUNDS;
+        return rows_[y][x];
+    }
+    const char* getRow(size_t y) const { return rows_[y]; }
+
+    // a copy of row y with the '%' overlay at x, for views that hand out whole rows
+    Row copyRowWithSelf(size_t x, size_t y) const;
+
+    // the cells showing one kind of symbol, row by row
+    const std::vector<Position>& getPositions(SymbolList list) const { return *lists_[list]; }
+    const SymbolLists& getSymbolLists() const { return lists_; }
+
+    static int listOf(char symbol);  // the SymbolList of a symbol, or -1 (' ', '&', '%')
+    static bool isBefore(Position a, Position b) {  // row-major order: the order the board is scanned in
+        return a.getY() != b.getY() ? a.getY() < b.getY() : a.getX() < b.getX();
+    }
+
+    size_t getWidth() const { return width_; }
+    size_t getHeight() const { return height_; }
+    uint64_t getSequence() const { return sequence_; }
+
+private:
+    size_t width_;
+    size_t height_;
+    uint64_t sequence_;
+    std::vector<const char*> rows_;  // start of every row, inside storage_
+    std::vector<Row> storage_;
+    SymbolLists lists_;
+};
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "BitGrid.h"
+
+// Bit-parallel flood fill over a BitGrid of passable cells, 64 cells per word op, 4 neighbours.
+// the board is a torus, as in the game: fills wrap around the left/right and top/bottom edges.
+// - reachable(): which cells can be reached at all. a row is filled along whole runs of
+//   passable cells at once, then spreads to the rows above and below, until nothing changes -
+//   the work follows the number of turns a path needs, not its length.
+// - distances(): exact BFS layers, each one the last shifted a cell in the 4 directions. only
+//   the blocks (BitGrid::BLOCK_WORDS words) at and next to the last layer are worked on. it
+//   pays off when the layers run along the rows (a row of sources, fronts moving up or down);
+//   a layer from a few point sources only has a couple of cells per row, and then this is no
+//   faster than a cell-by-cell BFS.
+// the word kernels have a scalar and an AVX2 version; the best one for the running CPU is
+// picked once, at runtime. buffers are kept between fills.
+class BitFlood {
+public:
+    enum class Kernel { Scalar, AVX2 };
+
+    static Kernel bestKernel();
+    static bool isSupported(Kernel kernel);
+    static const char* kernelName(Kernel kernel);
+
+    static constexpr int32_t UNREACHABLE = -1;
+
+    explicit BitFlood(Kernel kernel = bestKernel()) : kernel_(kernel) {}
+
+    // dist[y * width + x]: moves (4 neighbours) from the nearest source to every passable cell,
+    // UNREACHABLE where no source gets. sources off the passable cells are ignored
+    void distances(const BitGrid& passable, const BitGrid& sources, std::vector<int32_t>& dist);
+    // reached: the passable cells some source can get to (resized to passable's size)
+    void reachable(const BitGrid& passable, const BitGrid& sources, BitGrid& reached);
+
+private:
+    void prepare(int width, int height, int blocksPerRow);
+    void expandLayer(const BitGrid& passable);
+    uint64_t* blocksOf(std::vector<uint64_t>& masks, int y) { return &masks[static_cast<size_t>(y) * maskWords_]; }
+
+    Kernel kernel_;
+    BitGrid reached_;
+    BitGrid frontier_;
+    BitGrid next_;
+    // per row, a bit per block: the blocks with frontier_ / next_ bits
+    std::vector<uint64_t> frontierBlocks_;
+    std::vector<uint64_t> nextBlocks_;
+    int maskWords_ = 0;
+    std::vector<uint64_t> candidates_;  // the blocks of the row being expanded
+    std::vector<int> frontierRows_;  // the rows with frontier_ bits
+    std::vector<int> nextRows_;
+    std::vector<uint32_t> rowStamp_;  // == stamp_: the row was worked on in the current layer
+    uint32_t stamp_ = 0;
+    // reachable(): the rows to spread into, a ring with one slot per row (a row is queued at most once)
+    std::vector<int> rowQueue_;
+    std::vector<uint8_t> rowQueued_;
+};
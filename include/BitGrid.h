@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// One bit per cell, 64 cells per word, row by row. rows are a whole number of blocks of
+// BLOCK_WORDS words (one AVX2 register), and every row is framed by a zero word on each side,
+// so code working on whole words can read the word left and right of any word of a row
+// without checks. the bits past the width are always 0.
+class BitGrid {
+public:
+    static constexpr int BLOCK_WORDS = 4;
+
+    BitGrid() = default;
+    BitGrid(int width, int height) { reset(width, height); }
+
+    void reset(int width, int height);  // resized and all clear
+    void clear();
+
+    bool get(int x, int y) const { return (row(y)[x >> 6] >> (x & 63)) & 1; }
+    void set(int x, int y) { row(y)[x >> 6] |= uint64_t(1) << (x & 63); }
+    void unset(int x, int y) { row(y)[x >> 6] &= ~(uint64_t(1) << (x & 63)); }
+
+    uint64_t* row(int y) { return &words_[static_cast<size_t>(y) * stride_ + 1]; }
+    const uint64_t* row(int y) const { return &words_[static_cast<size_t>(y) * stride_ + 1]; }
+
+    int getWidth() const { return width_; }
+    int getHeight() const { return height_; }
+    int getWordsPerRow() const { return wordsPerRow_; }
+    int getBlocksPerRow() const { return wordsPerRow_ / BLOCK_WORDS; }
+
+private:
+    int width_ = 0;
+    int height_ = 0;
+    int wordsPerRow_ = 0;
+    int stride_ = 0;  // wordsPerRow_ + the two frame words
+    std::vector<uint64_t> words_;
+};
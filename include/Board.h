@@ -5,41 +5,118 @@
 #ifndef BOARD_H
 #define BOARD_H
 
+#include <cstdint>
 #include <vector>
 #include <memory>
+#include <string>
+#include <unordered_map>
 #include "Tank.h"
 #include "Shell.h"
 #include "Mine.h"
 #include "Wall.h"
 #include "Position.h"
+#include "BoardObserver.h"
+
+// Occupancy bits kept for every cell, so "is there a wall/mine/tank/shell here?"
+// is answered from one byte without touching the objects themselves.
+enum CellOccupancy : uint8_t {
+    CELL_EMPTY = 0,
+    CELL_WALL  = 1 << 0,
+    CELL_MINE  = 1 << 1,
+    CELL_TANK  = 1 << 2,
+    CELL_SHELL = 1 << 3,  // CELL_WALL..CELL_SHELL are 1 << ObjectKind
+    CELL_MULTI = 1 << 7   // more than one object - the objects live in the side table
+};
+
+// Read-only view over the objects of one cell (first added object is front()).
+// It points into the board, so don't keep it across add/remove calls.
+class CellObjects {
+public:
+    CellObjects() = default;
+    CellObjects(GameObject* const* begin, GameObject* const* end) : begin_(begin), end_(end) {}
+
+    GameObject* const* begin() const { return begin_; }
+    GameObject* const* end() const { return end_; }
+    size_t size() const { return static_cast<size_t>(end_ - begin_); }
+    bool empty() const { return begin_ == end_; }
+    GameObject* front() const { return *begin_; }
+    GameObject* operator[](size_t i) const { return begin_[i]; }
+
+private:
+    GameObject* const* begin_ = nullptr;
+    GameObject* const* end_ = nullptr;
+};
 
 class Board {
 private:
     int width_, height_;
-    std::vector<std::vector<std::vector<GameObject*>>> grid;
+
+    // one contiguous row-major array for the whole board (index = y * width + x).
+    // most cells hold zero or one object, so the object itself is stored inline,
+    // and only the rare crowded cell moves all of its objects to multiOccupants_.
+    std::vector<GameObject*> cells_;
+    std::vector<uint8_t> occupancy_;   // CellOccupancy bits per cell
+    std::vector<uint8_t> wallHp_;      // hits left for the wall in the cell (0 = no wall)
+    std::vector<uint16_t> shellCount_; // shells in flight are not objects (see ShellPool), only counted per cell
+    std::unordered_map<int, std::vector<GameObject*>> multiOccupants_;
+    BoardObserver* observer_ = nullptr;
+
+    int indexOf(Position pos) const {
+        // in-range positions (the common case) skip the two modulos of wrap()
+        if (static_cast<unsigned>(pos.getX()) >= static_cast<unsigned>(width_) ||
+            static_cast<unsigned>(pos.getY()) >= static_cast<unsigned>(height_)) {
+            pos.wrap(width_, height_); // note: the function gets a copy of "pos", so this does not change the original Position
+        }
+        return pos.getY() * width_ + pos.getX();
+    }
+    void refreshOccupancy(int index);
+    void notify(BoardChangeKind kind, ObjectKind objectKind, int index, int toIndex = -1) {
+        if (observer_) observer_->onBoardChange({kind, objectKind, index, toIndex});
+    }
+    void attach(GameObject* obj, int index);
+    bool detach(GameObject* obj, int index);
 
 public:
     Board(int w, int h);
-    ~Board();
 
     //Getters
     int getWidth() const { return width_; }
     int getHeight() const { return height_; }
 
+    // one observer gets every change from now on (nullptr to stop). the board doesn't own it.
+    void setObserver(BoardObserver* observer) { observer_ = observer; }
+    int indexOfPosition(Position pos) const { return indexOf(pos); }
+
     void addGameObject(GameObject* obj, Position pos);
-    const std::vector<GameObject*>& getObjectsAt(Position pos) const;
+    CellObjects getObjectsAt(Position pos) const;
     void removeAllAt(Position pos);
     void removeObject(GameObject* objToRemove, Position pos);
+    void moveObject(GameObject* obj, Position from, Position to);
 
-    bool isWall(Position pos) const {
-        // Returns true if the cell at (x,y) contains a wall
-        return getObjectsAt(pos).front()->getSymbol() == '#';
-    }
+    // shells in flight - they only set CELL_SHELL and the per-cell count
+    void addShell(Position pos);
+    void removeShell(Position pos);
+    void moveShell(Position from, Position to);
+    int getShellCount(Position pos) const { return shellCount_[indexOf(pos)]; }
+
+    // a shell hit the wall: takes one hit off it and keeps the wall planes in sync.
+    // returns true if the wall is now destroyed.
+    bool hitWall(Wall& wall);
 
-    //void cleanDestroyedWalls();
-    //void clear();
+    // occupancy queries - O(1), no object access
+    uint8_t getOccupancy(Position pos) const { return occupancy_[indexOf(pos)]; }
+    bool isWall(Position pos) const { return (getOccupancy(pos) & CELL_WALL) != 0; }
+    bool hasMine(Position pos) const { return (getOccupancy(pos) & CELL_MINE) != 0; }
+    bool hasTank(Position pos) const { return (getOccupancy(pos) & CELL_TANK) != 0; }
+    bool hasShell(Position pos) const { return (getOccupancy(pos) & CELL_SHELL) != 0; }
+    bool isEmpty(Position pos) const { return getOccupancy(pos) == CELL_EMPTY; }
+    int getWallHp(Position pos) const { return wallHp_[indexOf(pos)]; }
 
+    static uint8_t occupancyBitFor(const GameObject& obj);
 
+    // debug check of the whole board (O(cells)); on failure describes the first problem found.
+    // the game manager runs it every step when built with TANKGAME_CHECK_BOARD.
+    bool checkConsistency(std::string* problem = nullptr) const;
 };
 
 #endif //BOARD_H
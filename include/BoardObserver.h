@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+#include "GameObject.h"
+
+// What changed on the board. cells are board indexes (y * width + x); toIndex is only
+// used by ObjectMoved / ShellMoved, and objectKind means nothing for CellCleared.
+enum class BoardChangeKind : uint8_t {
+    ObjectAdded,
+    ObjectRemoved,
+    ObjectMoved,
+    CellCleared,     // removeAllAt
+    ShellAdded,
+    ShellRemoved,
+    ShellMoved,
+    WallDamaged,     // hit, still standing
+    WallDestroyed,   // hit for the last time (it stays in the cell until removed)
+    MineTriggered    // a destroyed mine taken off the board
+};
+
+struct BoardChange {
+    BoardChangeKind kind;
+    ObjectKind objectKind;
+    int index;
+    int toIndex;
+};
+
+// Gets every change made to the board, right after the board applied it (see Board::setObserver).
+// used to keep derived views (like the satellite raster) up to date in O(changes).
+class BoardObserver {
+public:
+    virtual ~BoardObserver() = default;
+    virtual void onBoardChange(const BoardChange& change) = 0;
+};
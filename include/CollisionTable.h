@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+#include "GameObject.h"
+
+// What happens when an object that just moved (the "mover") meets another object in its cell.
+// Effects are bit flags, so one entry can both destroy the mover and damage the other object.
+enum CollisionEffect : uint8_t {
+    COLLIDE_NOTHING       = 0,
+    COLLIDE_DESTROY_MOVER = 1 << 0,
+    COLLIDE_DESTROY_OTHER = 1 << 1,
+    COLLIDE_DAMAGE_OTHER  = 1 << 2   // walls take a hit instead of being destroyed
+};
+
+// All the collision rules of the game, in one place: RULES[mover kind][other kind].
+// Walls and mines never move, so their rows are empty. a tank never enters a wall cell
+// (the move is ignored before that), and tanks don't react to shells here - the shell
+// side of that pair is what kills the tank.
+namespace CollisionTable {
+
+    constexpr uint8_t BOTH_DESTROYED = COLLIDE_DESTROY_MOVER | COLLIDE_DESTROY_OTHER;
+
+    constexpr uint8_t RULES[OBJECT_KIND_COUNT][OBJECT_KIND_COUNT] = {
+        //                 Wall                                         Mine             Tank             Shell
+        /* Wall  */ { COLLIDE_NOTHING,                             COLLIDE_NOTHING, COLLIDE_NOTHING, COLLIDE_NOTHING },
+        /* Mine  */ { COLLIDE_NOTHING,                             COLLIDE_NOTHING, COLLIDE_NOTHING, COLLIDE_NOTHING },
+        /* Tank  */ { COLLIDE_NOTHING,                             BOTH_DESTROYED,  BOTH_DESTROYED,  COLLIDE_NOTHING },
+        /* Shell */ { COLLIDE_DESTROY_MOVER | COLLIDE_DAMAGE_OTHER, COLLIDE_NOTHING, BOTH_DESTROYED,  BOTH_DESTROYED  },
+    };
+
+    inline uint8_t lookup(ObjectKind mover, ObjectKind other) {
+        return RULES[static_cast<int>(mover)][static_cast<int>(other)];
+    }
+}
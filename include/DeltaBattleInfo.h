@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// The cells that changed between two satellite snapshots, for algorithms that keep their own
+// model of the board: if baseSequence is the sequence of the snapshot they last saw, applying
+// these cells brings them to `sequence` in O(changes), without rescanning the board.
+// optional - it comes with a full snapshot anyway (MyBattleInfo::getDelta), and it is missing
+// when the tank fell too far behind.
+struct DeltaBattleInfo {
+    struct Cell {
+        int x;
+        int y;
+        char symbol;  // as in the snapshot (no '%' overlay)
+    };
+
+    uint64_t baseSequence = 0;
+    uint64_t sequence = 0;
+    std::vector<Cell> cells;  // row by row, each cell once
+};
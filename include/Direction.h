@@ -16,5 +16,24 @@ enum class Direction {
     DownRight
 };
 
+constexpr int DIRECTION_COUNT = 8;
+
+// one step in each direction, in enum order (y grows downwards)
+inline constexpr int DIRECTION_DX[DIRECTION_COUNT] = { 0, 0, -1, 1, -1,  1, -1, 1 };
+inline constexpr int DIRECTION_DY[DIRECTION_COUNT] = { -1, 1, 0, 0, -1, -1,  1, 1 };
+
+// the enum is not in rotation order - rotate through these tables, never with enum arithmetic.
+// the directions clockwise from Up, and where each direction (in enum order) is in that circle
+inline constexpr Direction DIRECTION_CLOCKWISE[DIRECTION_COUNT] = {
+    Direction::Up, Direction::UpRight, Direction::Right, Direction::DownRight,
+    Direction::Down, Direction::DownLeft, Direction::Left, Direction::UpLeft
+};
+inline constexpr int DIRECTION_CLOCKWISE_INDEX[DIRECTION_COUNT] = { 0, 4, 6, 2, 7, 1, 5, 3 };
+
+// dir turned by a number of 45 degree steps (negative = to the left)
+inline constexpr Direction rotateDirection(Direction dir, int eighthsRight) {
+    return DIRECTION_CLOCKWISE[(DIRECTION_CLOCKWISE_INDEX[static_cast<int>(dir)] + eighthsRight % 8 + 8) % 8];
+}
+
 
 #endif //DIRECTION_H
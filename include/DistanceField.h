@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "BattlefieldSnapshot.h"
+#include "Direction.h"
+#include "Position.h"
+#include "Topology.h"
+#include "common/ActionRequest.h"
+
+// How many game steps a tank needs, from every (cell, direction) state of a snapshot, to drive
+// into the nearest of a set of target cells - one multi-source search over all the states,
+// backwards from the targets. a step is one action: a move forward (8 directions, so diagonals
+// too) or a 45/90 degree rotation. every action costs the same one step, so a plain BFS over the
+// states is exact (a 0-1 BFS or a bucket queue would only be needed for free actions).
+// '#' blocks, anything else is free. moves wrap around the edges, like the game's.
+// a player computes one per step from all the enemies it sees, and each of its tanks takes the
+// action that goes one step downhill: one search per step, however many tanks there are.
+class DistanceField {
+public:
+    static constexpr int32_t UNREACHABLE = -1;
+
+    void compute(const BattlefieldSnapshot& snapshot, const std::vector<Position>& sources);
+
+    int32_t distanceAt(Position pos, Direction dir) const { return dist_[stateOf(pos, dir)]; }
+    // the first action of a shortest way to a target: MoveForward if it is on one, else a rotation.
+    // DoNothing on a target, or when none can be reached
+    ActionRequest nextActionFrom(Position pos, Direction dir) const;
+
+    int getWidth() const { return topology_.getWidth(); }
+    int getHeight() const { return topology_.getHeight(); }
+    const Topology& getTopology() const { return topology_; }
+    uint64_t getSequence() const { return sequence_; }  // of the snapshot it was computed on
+
+private:
+    int stateOf(Position pos, Direction dir) const {
+        return topology_.indexOf(pos) * DIRECTION_COUNT + static_cast<int>(dir);
+    }
+
+    Topology topology_;
+    uint64_t sequence_ = 0;
+    std::vector<int32_t> dist_;   // per state: cell * DIRECTION_COUNT + direction
+    std::vector<int32_t> queue_;
+};
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "BattlefieldSnapshot.h"
+#include "FireMatrix.h"
+#include "LineOfFire.h"
+#include "StepShared.h"
+#include "Topology.h"
+
+// A player's side of the fire matrix, kept for the whole game: the walls of the snapshots it
+// is shown, with their LineOfFire patched where walls came or went (the wall list of a snapshot
+// is shared with the one before when no wall changed, so most steps cost nothing here), and one
+// FireMatrix per step for all the player's tanks.
+// the LineOfFire is the player's one copy, handed to its tanks too (MyBattleInfo::getLineOfFire):
+// it is patched in place, so it follows the newest snapshot the player was shown.
+class FireContext {
+public:
+    FireContext() : lineOfFire_(std::make_shared<LineOfFire>()) {}
+
+    std::shared_ptr<const FireMatrix> matrixFor(const BattlefieldSnapshot& snapshot);
+    // the walls' LineOfFire, brought up to the snapshot's walls
+    std::shared_ptr<const LineOfFire> lineOfFireFor(const BattlefieldSnapshot& snapshot);
+
+private:
+    void followWalls(const BattlefieldSnapshot& snapshot);
+
+    Topology topology_;
+    std::vector<uint8_t> walls_;  // one byte per cell, row-major
+    BattlefieldSnapshot::PositionList seenWalls_;  // the wall list walls_ matches
+    std::shared_ptr<LineOfFire> lineOfFire_;
+    StepShared<FireMatrix> matrices_;
+};
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "BattlefieldSnapshot.h"
+#include "Direction.h"
+#include "LineOfFire.h"
+#include "Position.h"
+#include "Topology.h"
+
+// Who can shoot whom in a snapshot: for every tank, the first tank on each of its 8 lines, if no
+// wall is in the way - the tank a shell fired that way hits. the lines wrap around the board.
+// a shot along a line is a shot back along it too, so the aims of a tank are both the tanks it
+// can shoot and the tanks that can shoot it.
+// the tanks are bucketed by line (row, column and the two diagonals) and sorted along each one,
+// so only neighbours on a line are checked, against the LineOfFire of the snapshot's walls:
+// O(tanks log tanks) per step, for all the tanks of a player together.
+class FireMatrix {
+public:
+    static constexpr int32_t NONE = -1;
+
+    struct Tank {
+        Position pos;
+        int player;  // 1 or 2
+    };
+    struct Aim {
+        int32_t tank = NONE;  // index into getTanks()
+        int32_t steps = 0;    // cells a shell flies to get there
+    };
+
+    // lineOfFire must be of the snapshot's walls
+    void compute(const BattlefieldSnapshot& snapshot, const LineOfFire& lineOfFire);
+
+    const std::vector<Tank>& getTanks() const { return tanks_; }
+    int tankAt(Position pos) const;  // index into getTanks(), or NONE
+    Aim aim(int tank, Direction d) const { return aims_[tank * DIRECTION_COUNT + static_cast<int>(d)]; }
+
+    // a shell fired from the tank at `from` in direction d hits the tank at target first
+    bool canShoot(Position from, Direction d, Position target) const;
+
+    uint64_t getSequence() const { return sequence_; }  // of the snapshot it was computed on
+
+private:
+    // a tank on one of the 4 kinds of line (one per forward direction)
+    struct OnLine {
+        int32_t kind;
+        int32_t line;
+        int32_t place;
+        int32_t tank;
+        bool operator<(const OnLine& other) const {
+            if (kind != other.kind) return kind < other.kind;
+            if (line != other.line) return line < other.line;
+            return place < other.place;
+        }
+    };
+
+    uint64_t sequence_ = 0;
+    std::vector<Tank> tanks_;     // row by row
+    std::vector<Aim> aims_;       // per tank and direction: tank * DIRECTION_COUNT + direction
+    std::vector<OnLine> onLine_;  // scratch
+};
@@ -4,10 +4,17 @@
 
 #include "Board.h"
 #include "Tank.h"
+#include "TankStore.h"
+#include "GameStats.h"
+#include "BattlefieldSnapshot.h"
+#include "SatelliteRaster.h"
 #include "Mine.h"
 #include "Wall.h"
 #include "Shell.h"
+#include "ShellPool.h"
+#include "ShellCollisionFinder.h"
 #include "InputParser.h"
+#include "CollisionTable.h"
 #include "Position.h"
 #include "common/Player.h"
 #include "common/PlayerFactory.h"
@@ -19,12 +26,10 @@
 #include <fstream>
 #include <memory>
 #include <vector>
-#include <xmmintrin.h>
 
 class GameManager {
 public:
     static constexpr int STEPS_WHEN_SHELLS_OVER = 40;
-    static constexpr int SHELL_MOVES_PER_STEP = 2;
   	static constexpr int NUM_SHELLS = 20;
     const int MAX_TOTAL_STEPS = 50000;
 
@@ -36,6 +41,9 @@ public:
     bool readBoard(const std::string& inputFile);
     void run();
 
+    //alive tanks and shells left, updated as the game runs (for instrumentation)
+    const GameStats& getStats() const { return stats_; }
+
 
 
 private:
@@ -44,11 +52,29 @@ private:
     Board board_;
     std::vector<std::unique_ptr<Wall>> walls_;
     std::vector<std::unique_ptr<Mine>> mines_;
-    std::vector<std::unique_ptr<Shell>> shells_;
+    ShellPool shells_;
+    ShellCollisionFinder shellCollisionFinder_;
+    std::vector<int> crossedShells_;
 
     std::vector<std::unique_ptr<Tank>> p1Tanks_;
     std::vector<std::unique_ptr<Tank>> p2Tanks_;
     std::vector<Tank*> allTanksSorted_;
+    TankStore tankStore_;  //per-tank counters and flags, one slot per tank
+    GameStats stats_;
+    //the board as it was before the current step, taken by the first GetBattleInfo of the step
+    //from the raster, which follows the board's changes
+    std::unique_ptr<SatelliteRaster> raster_;
+    std::shared_ptr<const BattlefieldSnapshot> stepSnapshot_;
+    std::vector<uint64_t> lastSnapshotSequence_;  //per tank store slot: the snapshot the tank got last (0 = none)
+
+    //the step pipeline: alive tanks (player 1 first, then player 2, compacted once per step),
+    //and one bucket per phase, filled by the decide pass (movedTanks_ by the move handlers)
+    std::vector<Tank*> aliveTanks_;
+    std::vector<Tank*> battleInfoTanks_;
+    std::vector<Tank*> shootingTanks_;
+    std::vector<Tank*> actingTanks_;
+    std::vector<Tank*> autoMoveBackTanks_;
+    std::vector<Tank*> movedTanks_;
 
     std::unique_ptr<Player> player1_;
     std::unique_ptr<Player> player2_;
@@ -56,7 +82,7 @@ private:
     int maxSteps_ = MAX_TOTAL_STEPS; //default; can get another number from user
     int numShells_ = NUM_SHELLS; //default; can get another number from user
     int stepsLeftWhenShellsOver_ = STEPS_WHEN_SHELLS_OVER;
-    int shellMovesPerStep_ = SHELL_MOVES_PER_STEP;
+    int shellMovesPerStep_ = Shell::MOVES_PER_STEP;
     int stepCounter_ = 0;
 
     int boardWidth_;
@@ -82,10 +108,18 @@ private:
     ActionRequest decideAction(Tank& t, TankAlgorithm& algo);
 
     int getTotalShellsLeft() const;
-    void countersHandler(Tank& tank);
+    const std::shared_ptr<const BattlefieldSnapshot>& getStepSnapshot();
     void handleAutoMoveTankBack(Tank& tank);
+    void moveTankOnBoard(Tank& tank, Position oldPos, Position newPos);
+    void clearPhaseBuckets();
+    void compactAliveTanks();
 
-    void resolveShellCollisionsAtPosition(Shell& shell);
+    void resolveShellCollisionsAtPosition(int shellSlot);
+    void applyShellCollision(int shellSlot, GameObject& other);
+    void destroyCollidedShells(const std::vector<int>& shellSlots);
+    void releaseDestroyedShells();
+    void applyCollision(GameObject& mover, GameObject& other);
+    void destroyObject(GameObject& obj);
 
     template<typename T>
     void cleanupDestroyedObjects(std::vector<std::unique_ptr<T>>& vec) {
@@ -99,12 +133,13 @@ private:
             }), vec.end());
     }
 
-    void moveForwardAndWrap(Shell& shell);
+    void moveAllShellsForwardAndWrap();
     void resolveTankCollisionsAtPosition(Tank& tank);
     void shellStep();
+    void removeKilledTanksFromBoard();
+    void checkBoardConsistency() const;
 
     //get pointers
-    std::vector<Shell*> getShellPtrs() const;
     std::vector<Mine*> getMinePtrs() const;
 
     //more helper functions
@@ -119,5 +154,5 @@ private:
 
     void printRoundToFile();
     void printGameResult(int p1Alive, int p2Alive);
-    bool checkIfPlayerLostAllTanks(int& p1Alive, int& p2Alive);
+    bool checkIfPlayerLostAllTanks(int& p1Alive, int& p2Alive) const;
 };
@@ -5,14 +5,27 @@
 #ifndef GAMEOBJECT_H
 #define GAMEOBJECT_H
 
+#include <cstdint>
 #include "Position.h"
 
+// compact type tag, so the engine can tell what an object is without dynamic_cast.
+// the order matters: Board's occupancy bits and the collision table are indexed by it.
+enum class ObjectKind : uint8_t {
+    Wall,
+    Mine,
+    Tank,
+    Shell
+};
+
+constexpr int OBJECT_KIND_COUNT = 4;
+
 class GameObject {
 public:
-    explicit GameObject(Position pos) //"explicit", to avoid implicit conversions
-        : pos_(pos) {}
+    GameObject(Position pos, ObjectKind kind)
+        : pos_(pos), kind_(kind) {}
 
     virtual char getSymbol() const = 0;
+    ObjectKind getKind() const { return kind_; }
     Position getPosition() const { return pos_; }
     void setPosition(const Position& pos) { pos_ = pos; }
     virtual void destroy() { destroyed_ = true; }
@@ -21,6 +34,7 @@ public:
 
 protected:
     Position pos_;
+    ObjectKind kind_;
     bool destroyed_ = false;
 };
 
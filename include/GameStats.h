@@ -0,0 +1,15 @@
+#pragma once
+
+// Game-wide counters, kept up to date by the game manager at the moment a tank dies or fires,
+// so the win check and the shells-over countdown never have to scan the tanks.
+// read-only for everyone else (GameManager::getStats).
+struct GameStats {
+    int aliveTanks[2] = {0, 0};  // per player: index 0 is player 1, index 1 is player 2
+    int shellsLeft = 0;          // shells the tanks hold - a dead tank's too, as the shells-over rule counts them
+    int tanksKilled = 0;
+    int shellsFired = 0;
+    long snapshotsBuilt = 0;      // board rasterizations for GetBattleInfo (at most one per step)
+    long battleInfoServed = 0;    // GetBattleInfo requests answered with a snapshot
+
+    int getAliveTanks(int playerId) const { return aliveTanks[playerId - 1]; }
+};
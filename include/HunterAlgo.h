@@ -2,9 +2,8 @@
 
 #include "common/TankAlgorithm.h"
 #include "MyBattleInfo.h"
+#include "DistanceField.h"
 #include <vector>
-#include <queue>
-#include <unordered_map>
 #include "Position.h"
 #include "Direction.h"
 #include <optional>
@@ -20,14 +19,15 @@ public:
 private:
     int tankId_;
     std::optional<MyBattleInfo> currentInfo_;
-    std::vector<Position> currentPath;
+
+    // where we are and where we face: from the battle info, then followed through our own
+    // moves and rotations until the next one
+    Position myPos_;
     Direction currentDirection_;
+    bool directionKnown_;
+    bool shotSinceUpdate_ = false;  // we fire at most once per battle info
+    // the way to the enemies when our player didn't send one with the battle info
+    DistanceField ownField_;
     int turnsSinceLastUpdate_;
     static constexpr int UPDATE_INTERVAL = 4;
-
-    std::vector<Position> runBFS(const Position& start, const Position& goal,
-                                 const std::vector<std::vector<char>>& grid);
-
-    Direction getDirectionTo(const Position& from, const Position& to) const;
-    ActionRequest rotateToward(Direction current, Direction target) const;
 };
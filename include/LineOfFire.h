@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "Direction.h"
+#include "Position.h"
+#include "Topology.h"
+
+// For every cell and each of the 8 directions, how many free cells a shell fired from there
+// crosses before it meets a wall - around the torus, as shells fly. built once from the walls,
+// then patched along the rays through a single cell when a wall appears or is shot down, so
+// "can I hit that tank from here" is a lookup instead of a walk.
+// the walls are not copied: the owner keeps them (one byte per cell, row-major, non-zero is a
+// wall) and passes them in. only walls block here - tanks and shells in the way are not known.
+class LineOfFire {
+public:
+    static constexpr int32_t NO_WALL = INT32_MAX;  // the ray goes around without meeting one
+
+    void build(const Topology& topology, const uint8_t* walls);
+    // walls[cell] has just changed (either way): redo the rays that pass through it
+    void wallChanged(const uint8_t* walls, int cell);
+
+    // free cells from `from` (not counted) in direction d, up to the first wall
+    int32_t clearCells(Position from, Direction d) const { return clear_[stateOf(topology_.indexOf(from), d)]; }
+    // a shell fired from `from` in direction d gets to `target` before any wall
+    bool canHit(Position from, Direction d, Position target) const;
+
+    const Topology& getTopology() const { return topology_; }
+
+private:
+    static int stateOf(int cell, Direction d) { return cell * DIRECTION_COUNT + static_cast<int>(d); }
+
+    Topology topology_;
+    std::vector<int32_t> clear_;  // per (cell, direction): cell * DIRECTION_COUNT + direction
+    std::vector<int32_t> ray_;    // scratch: the cells of one ray, while building
+    std::vector<uint8_t> seen_;   // scratch: cells already on a built ray, while building
+};
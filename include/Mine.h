@@ -6,7 +6,7 @@
 
 class Mine : public GameObject {
 public:
-    explicit Mine(Position pos) : GameObject(pos) {}
+    explicit Mine(Position pos) : GameObject(pos, ObjectKind::Mine) {}
     char getSymbol() const override { return '@'; }
 };
 
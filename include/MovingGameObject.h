@@ -11,8 +11,8 @@
 
 class MovingGameObject : public GameObject {
 public:
-    MovingGameObject(Position pos, Direction dir)
-        : GameObject(pos), dir_(dir) {}
+    MovingGameObject(Position pos, ObjectKind kind, Direction dir)
+        : GameObject(pos, kind), dir_(dir) {}
     Direction getDirection() const { return dir_; }
     void setDirection(Direction dir) { dir_ = dir;  }
     virtual bool moveForward () = 0;
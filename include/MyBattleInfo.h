@@ -1,30 +1,102 @@
 #pragma once
 
 #include "common/BattleInfo.h"
-#include "common/SatelliteView.h"
+#include "common/BulkSatelliteView.h"
+#include "BattlefieldSnapshot.h"
+#include "DeltaBattleInfo.h"
+#include "DistanceField.h"
+#include "FireMatrix.h"
+#include "LineOfFire.h"
+#include "ShellThreatMap.h"
 #include "Direction.h"
+#include <memory>
 #include <utility>
 #include <vector>
 #include <tuple>
 
-class MyBattleInfo : public BattleInfo {
+// What a tank algorithm gets on GetBattleInfo. it shares the satellite view's snapshot, so
+// building it - and copying it, as the algorithms do to keep it - is O(1).
+// it is also a BulkSatelliteView, so the algorithms can read it row by row.
+class MyBattleInfo final : public BattleInfo, public BulkSatelliteView {
 public:
-    MyBattleInfo(const SatelliteView& view, int playerIndex, size_t rows, size_t cols,
+    // shares the snapshot when the view is a SatelliteViewImpl; any other view is copied once
+    // (row by row if it is a BulkSatelliteView, else rows x cols getObjectAt calls) and the
+    // self position is taken from its '%'
+    MyBattleInfo(const SatelliteView& view, int playerIndex, size_t rows, size_t cols);
+    MyBattleInfo(std::shared_ptr<const BattlefieldSnapshot> snapshot, int playerIndex,
                  std::pair<size_t, size_t> selfPos);
 
-    char getObjectAt(size_t x, size_t y) const;
+    char getObjectAt(size_t x, size_t y) const override {
+        if (x == selfPos_.first && y == selfPos_.second) return BattlefieldSnapshot::SELF;
+        return snapshot_->getObjectAt(x, y);
+    }
 
-    size_t getRows() const { return rows_; }
-    size_t getCols() const { return cols_; }
+    size_t getWidth() const override { return snapshot_->getWidth(); }
+    size_t getHeight() const override { return snapshot_->getHeight(); }
+    const char* getRow(size_t y) const override {
+        return y == selfPos_.second && selfRow_ ? selfRow_->data() : snapshot_->getRow(y);
+    }
+
+    size_t getRows() const { return snapshot_->getHeight(); }
+    size_t getCols() const { return snapshot_->getWidth(); }
     int getPlayerIndex() const { return playerIndex_; }
     std::pair<size_t, size_t> getSelfPosition() const { return selfPos_; }
+    const std::shared_ptr<const BattlefieldSnapshot>& getSnapshot() const { return snapshot_; }
+    uint64_t getSequence() const { return snapshot_->getSequence(); }
+
+    // the changes since the snapshot this tank got before, or nullptr (then use the full snapshot).
+    // only usable if the algorithm still has the snapshot of getDelta()->baseSequence
+    const DeltaBattleInfo* getDelta() const { return delta_.get(); }
+
+    // where things are - the snapshot's lists, found once per step and shared by every battle
+    // info of it. row by row (the order of a scan of the view). the '%' hides our own tank, but
+    // the snapshot still lists it: getAllies() has our own cell too - skip getSelf()
+    Position getSelf() const { return Position((int)selfPos_.first, (int)selfPos_.second); }
+    const std::vector<Position>& getAllies() const { return snapshot_->getPositions(ownTanksList()); }
+    size_t getAllyCount() const {  // without self
+        bool selfListed = BattlefieldSnapshot::listOf(snapshot_->getObjectAt(selfPos_.first, selfPos_.second)) ==
+                          ownTanksList();
+        return getAllies().size() - (selfListed ? 1 : 0);
+    }
+    const std::vector<Position>& getEnemies() const {
+        return snapshot_->getPositions(ownTanksList() == BattlefieldSnapshot::PLAYER1_TANKS
+                                               ? BattlefieldSnapshot::PLAYER2_TANKS
+                                               : BattlefieldSnapshot::PLAYER1_TANKS);
+    }
+    const std::vector<Position>& getWalls() const { return snapshot_->getPositions(BattlefieldSnapshot::WALLS); }
+    const std::vector<Position>& getMines() const { return snapshot_->getPositions(BattlefieldSnapshot::MINES); }
+    const std::vector<Position>& getShells() const { return snapshot_->getPositions(BattlefieldSnapshot::SHELLS); }
 
     Direction inferSelfDirection() const;
 
+    // distances to the nearest enemy, shared by all the player's tanks for this step - set by
+    // players that compute one (Player2), else nullptr
+    const DistanceField* getEnemyDistances() const { return enemyDistances_.get(); }
+    void setEnemyDistances(std::shared_ptr<const DistanceField> field) { enemyDistances_ = std::move(field); }
+    // where the shells may fly over the next steps, shared the same way - set by Player1, else nullptr
+    const ShellThreatMap* getShellThreats() const { return shellThreats_.get(); }
+    void setShellThreats(std::shared_ptr<const ShellThreatMap> threats) { shellThreats_ = std::move(threats); }
+    // who can shoot whom along the 8 directions this step - set by both players, else nullptr
+    const FireMatrix* getFireMatrix() const { return fireMatrix_.get(); }
+    void setFireMatrix(std::shared_ptr<const FireMatrix> matrix) { fireMatrix_ = std::move(matrix); }
+    // how far a shell flies from each cell before a wall - the player's one copy for all its tanks
+    // (see FireContext), set by both players, else nullptr. the player patches it in place as walls
+    // go, so it may already be ahead of this snapshot's walls
+    const LineOfFire* getLineOfFire() const { return lineOfFire_.get(); }
+    void setLineOfFire(std::shared_ptr<const LineOfFire> lineOfFire) { lineOfFire_ = std::move(lineOfFire); }
+
 private:
-    std::vector<std::vector<char>> battlefield_;
-    size_t rows_;
-    size_t cols_;
+    BattlefieldSnapshot::SymbolList ownTanksList() const {
+        return playerIndex_ == 2 ? BattlefieldSnapshot::PLAYER2_TANKS : BattlefieldSnapshot::PLAYER1_TANKS;
+    }
+
+    std::shared_ptr<const BattlefieldSnapshot> snapshot_;
+    BattlefieldSnapshot::Row selfRow_;  // the snapshot's row of selfPos_, with the '%'
+    std::shared_ptr<const DeltaBattleInfo> delta_;
+    std::shared_ptr<const DistanceField> enemyDistances_;
+    std::shared_ptr<const ShellThreatMap> shellThreats_;
+    std::shared_ptr<const FireMatrix> fireMatrix_;
+    std::shared_ptr<const LineOfFire> lineOfFire_;
     int playerIndex_;
     std::pair<size_t, size_t> selfPos_;
 };
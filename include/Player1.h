@@ -4,6 +4,9 @@
 #include "ZoneControlAlgo.h"
 #include "MyBattleInfo.h"
 #include "common/SatelliteView.h"
+#include "ShellThreatMap.h"
+#include "FireContext.h"
+#include "StepShared.h"
 
 class Player1 : public Player {
 public:
@@ -16,4 +19,7 @@ private:
     int player_index_;
     size_t board_width_;
     size_t board_height_;
+
+    StepShared<ShellThreatMap> shellThreats_;  // for our dodging, computed on the first call of a step
+    FireContext fire_;  // who can shoot whom, once per step
 };
@@ -4,6 +4,9 @@
 #include "HunterAlgo.h"
 #include "MyBattleInfo.h"
 #include "common/SatelliteView.h"
+#include "DistanceField.h"
+#include "FireContext.h"
+#include "StepShared.h"
 
 class Player2 : public Player {
 public:
@@ -16,4 +19,7 @@ private:
     int player_index_;
     size_t board_width_;
     size_t board_height_;
+
+    StepShared<DistanceField> enemyDistances_;  // to our enemies, computed on the first call of a step
+    FireContext fire_;  // who can shoot whom, once per step
 };
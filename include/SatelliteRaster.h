@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <vector>
+#include "Board.h"
+#include "BoardObserver.h"
+#include "BattlefieldSnapshot.h"
+#include "DeltaBattleInfo.h"
+
+// The satellite picture of a board, kept up to date from the board's change events instead of
+// being rebuilt from every cell. changes only mark cells (and their rows) dirty; snapshot()
+// then redraws the dirty cells, into fresh copies of the dirty rows (older snapshots still
+// share the old ones), so it costs O(changes + dirty rows * width + height), not O(cells).
+// the symbol lists are patched the same way: only the lists of symbols that changed are rebuilt.
+// register it with board.setObserver() right after constructing it.
+class SatelliteRaster : public BoardObserver {
+public:
+    explicit SatelliteRaster(const Board& board);  // draws the whole board once
+
+    void onBoardChange(const BoardChange& change) override;
+
+    std::shared_ptr<const BattlefieldSnapshot> snapshot();
+
+    // the cells that changed from snapshot baseSequence to the latest snapshot() (call that
+    // first). nullptr when baseSequence is too old to be in the journal, or when so much
+    // changed that the full snapshot is just as cheap.
+    std::shared_ptr<const DeltaBattleInfo> deltaSince(uint64_t baseSequence) const;
+
+    int getDirtyCellCount() const { return static_cast<int>(dirtyCells_.size()); }
+
+private:
+    static constexpr size_t MAX_JOURNAL_SNAPSHOTS = 64;
+
+    // the cells whose symbol changed to make one snapshot (from the one before it)
+    struct JournalEntry {
+        uint64_t sequence;
+        std::vector<int> cells;
+    };
+
+    void markDirty(int index);
+
+    const Board& board_;
+    int width_;
+    int height_;
+    std::vector<std::shared_ptr<std::vector<char>>> rows_;
+    BattlefieldSnapshot::SymbolLists lists_;
+    std::vector<int> dirtyCells_;
+    std::vector<uint8_t> isCellDirty_;
+    std::vector<uint8_t> isRowDirty_;
+    std::shared_ptr<const BattlefieldSnapshot> last_;  // returned again while nothing changed
+    uint64_t sequence_ = 0;
+    std::deque<JournalEntry> journal_;  // the last MAX_JOURNAL_SNAPSHOTS snapshots
+};
@@ -1,17 +1,38 @@
 #pragma once
 
-#include "common/SatelliteView.h"
-#include <vector>
+#include "common/BulkSatelliteView.h"
+#include "BattlefieldSnapshot.h"
+#include "DeltaBattleInfo.h"
+#include <memory>
+#include <utility>
 
-class SatelliteViewImpl : public SatelliteView {
+// The view given to a player for one GetBattleInfo: a shared snapshot of the board, plus the
+// requesting tank shown as '%' (an overlay, the snapshot itself is never changed - only the
+// tank's own row is copied, so getRow can return it with the '%').
+// it may also carry the cells that changed since the tank's previous view (see DeltaBattleInfo).
+class SatelliteViewImpl final : public BulkSatelliteView {
 public:
-    SatelliteViewImpl(const std::vector<std::vector<char>>& boardData);
+    SatelliteViewImpl(std::shared_ptr<const BattlefieldSnapshot> snapshot, std::pair<size_t, size_t> selfPos,
+                      std::shared_ptr<const DeltaBattleInfo> delta = nullptr);
 
     char getObjectAt(size_t x, size_t y) const override;
 
-    size_t getRows() const { return board_.size(); }
-    size_t getCols() const { return board_.empty() ? 0 : board_[0].size(); }
+    size_t getWidth() const override { return snapshot_->getWidth(); }
+    size_t getHeight() const override { return snapshot_->getHeight(); }
+    const char* getRow(size_t y) const override {
+        return y == selfPos_.second && selfRow_ ? selfRow_->data() : snapshot_->getRow(y);
+    }
+
+    size_t getRows() const { return snapshot_->getHeight(); }
+    size_t getCols() const { return snapshot_->getWidth(); }
+    const std::shared_ptr<const BattlefieldSnapshot>& getSnapshot() const { return snapshot_; }
+    std::pair<size_t, size_t> getSelfPosition() const { return selfPos_; }
+    const BattlefieldSnapshot::Row& getSelfRow() const { return selfRow_; }
+    const std::shared_ptr<const DeltaBattleInfo>& getDelta() const { return delta_; }
 
 private:
-    std::vector<std::vector<char>> board_;
+    std::shared_ptr<const BattlefieldSnapshot> snapshot_;
+    std::pair<size_t, size_t> selfPos_;
+    BattlefieldSnapshot::Row selfRow_;  // the snapshot's row of selfPos_, with the '%'
+    std::shared_ptr<const DeltaBattleInfo> delta_;
 };
@@ -11,6 +11,8 @@
 
 class Shell : public MovingGameObject {
 public:
+    static constexpr int MOVES_PER_STEP = 2;  // cells a shell flies each game step
+
     Shell(Position pos, Direction dir, int tankId);
 
     char getSymbol() const override { return '*'; }
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+
+// Vectorized "move every shell one cell forward and wrap" kernel, used by ShellPool.
+// Coordinates and per-shell steps are separate int32 arrays (x, y, dx, dy), so the kernel is
+// one add and a branch-free wrap per lane. The best kernel for the running CPU is picked once,
+// at runtime; the scalar one is always available.
+namespace ShellAdvance {
+
+    enum class Kernel { Scalar, SSE2, AVX2 };
+
+    Kernel bestKernel();
+    bool isSupported(Kernel kernel);
+    const char* kernelName(Kernel kernel);
+
+    // x[i] += dx[i], y[i] += dy[i], wrapped into [0, width) x [0, height).
+    // each step must be -1, 0 or 1, and the coordinates must start inside the board.
+    void advance(int32_t* x, int32_t* y, const int32_t* dx, const int32_t* dy, int count,
+                 int width, int height, Kernel kernel);
+
+    inline void advance(int32_t* x, int32_t* y, const int32_t* dx, const int32_t* dy, int count,
+                        int width, int height) {
+        advance(x, y, dx, dy, count, width, height, bestKernel());
+    }
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "ShellPool.h"
+
+// Finds shell vs shell collisions in O(shells), without looking at the board.
+//
+// - findCrossings(): run BEFORE the shells move. Two shells collide on the way if their moves
+//   share a midpoint: in doubled coordinates a move from p in direction d has the midpoint
+//   2p + d. Shells that swap cells (head-on, any direction) and shells whose diagonal moves
+//   cross inside a 2x2 block both land on the same midpoint.
+// - findSharedCells(): run AFTER the shells move. Live shells that ended in the same cell.
+//
+// Both bucket the live shells by their key in one open-addressing hash table that is reused
+// between calls, and return the slots of every shell that shares its key with another one.
+class ShellCollisionFinder {
+public:
+    const std::vector<int>& findCrossings(const ShellPool& shells, int boardWidth, int boardHeight);
+    const std::vector<int>& findSharedCells(const ShellPool& shells, int boardWidth);
+
+private:
+    struct Bucket {
+        int64_t key;
+        int firstSlot;   // first shell with this key
+        bool collided;   // a second shell came - firstSlot is already in hits_
+    };
+    static constexpr int64_t EMPTY_KEY = -1;
+
+    template<typename KeyOf>
+    const std::vector<int>& findCollisions(const ShellPool& shells, KeyOf keyOf);
+
+    std::vector<Bucket> table_;
+    std::vector<int> hits_;
+};
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "Position.h"
+#include "Direction.h"
+
+// All the shells in flight, stored as parallel arrays (one entry per slot) instead of one
+// heap object per shell. Destroyed shells wait in their slot until releaseDestroyed(),
+// and then the slot goes to a free list so the next shot reuses it without allocating.
+// When most slots are free, compact() packs the live shells to the front again.
+class ShellPool {
+public:
+    enum SlotState : uint8_t { SLOT_FREE, SLOT_ALIVE, SLOT_DESTROYED };
+
+    int spawn(Position pos, Direction dir, int ownerTankId);  // returns the slot
+    void destroy(int slot);
+
+    // moves one shell a single cell forward, wrapping around the board
+    void advance(int slot, int boardWidth, int boardHeight);
+
+    // moves every live shell a single cell forward, wrapping around the board, with the
+    // vectorized ShellAdvance kernel. free slots are advanced too (their data is unused),
+    // so it falls back to advance() while destroyed shells are waiting to be released.
+    void advanceAll(int boardWidth, int boardHeight);
+
+    // frees every destroyed slot. onRelease(slot) is called first, while the slot still
+    // holds the shell's data (the game manager uses it to take the shell off the board).
+    template<typename F>
+    void releaseDestroyed(F&& onRelease) {
+        if (destroyedCount_ == 0) return;
+        for (int slot = 0; slot < slotCount(); ++slot) {
+            if (state_[slot] != SLOT_DESTROYED) continue;
+            onRelease(slot);
+            state_[slot] = SLOT_FREE;
+            freeSlots_.push_back(slot);
+        }
+        destroyedCount_ = 0;
+    }
+
+    // packs the live shells to the front, keeping their order. slots change, so only
+    // call it when nobody holds a slot number.
+    void compact();
+    bool isSparse() const { return slotCount() >= MIN_SLOTS_TO_COMPACT && liveCount_ * 2 < slotCount(); }
+
+    //Getters
+    int slotCount() const { return static_cast<int>(state_.size()); }
+    int getLiveCount() const { return liveCount_; }
+    bool isAlive(int slot) const { return state_[slot] == SLOT_ALIVE; }
+    Position getPosition(int slot) const { return Position(x_[slot], y_[slot]); }
+    Direction getDirection(int slot) const { return static_cast<Direction>(dir_[slot]); }
+    int getOwnerId(int slot) const { return owner_[slot]; }
+
+private:
+    static constexpr int MIN_SLOTS_TO_COMPACT = 64;
+
+    std::vector<int32_t> x_;
+    std::vector<int32_t> y_;
+    std::vector<int32_t> dx_;     // per-shell step, taken from the direction once, at spawn
+    std::vector<int32_t> dy_;
+    std::vector<uint8_t> dir_;
+    std::vector<int32_t> owner_;  // id of the tank that fired the shell
+    std::vector<uint8_t> state_;  // SlotState
+
+    std::vector<int> freeSlots_;
+    int liveCount_ = 0;
+    int destroyedCount_ = 0;
+};
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "BattlefieldSnapshot.h"
+#include "Position.h"
+#include "Shell.h"
+#include "Topology.h"
+
+// Where the shells of a snapshot may be over the next few steps: for every cell, the first step
+// a shell can get there. each shell is projected Shell::MOVES_PER_STEP cells a step, around the
+// board, until it meets a wall. the view doesn't show which way a shell flies, so it is projected
+// along all 8 directions - a tank dodges anything that could be coming at it.
+// computing it costs O(shells * horizon), once per step for all the player's tanks; the marks
+// carry a generation, so nothing is cleared in between. a lookup is O(1).
+class ShellThreatMap {
+public:
+    static constexpr int MAX_HORIZON = 255;
+
+    // horizon: how many steps ahead (at most MAX_HORIZON)
+    void compute(const BattlefieldSnapshot& snapshot, int horizon);
+
+    // the first step (1 = the next one) a shell may be in pos, 0 if none within the horizon
+    int firstHitStep(Position pos) const {
+        uint32_t mark = marks_[topology_.indexOf(pos)];
+        return (mark >> STEP_BITS) == generation_ ? static_cast<int>(mark & STEP_MASK) : 0;
+    }
+
+    int getHorizon() const { return horizon_; }
+    uint64_t getSequence() const { return sequence_; }  // of the snapshot it was computed on
+
+private:
+    static constexpr int STEP_BITS = 8;
+    static constexpr uint32_t STEP_MASK = (1u << STEP_BITS) - 1;
+    static constexpr uint32_t MAX_GENERATION = UINT32_MAX >> STEP_BITS;
+
+    Topology topology_;
+    int horizon_ = 0;
+    uint64_t sequence_ = 0;
+    uint32_t generation_ = 0;
+    // per cell: generation << STEP_BITS | first step. marks of an older generation mean no shell
+    std::vector<uint32_t> marks_;
+};
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Something a player works out once per step from the snapshot and hands to all its tanks
+// through their battle infos (Player2's enemy distances, Player1's shell threats).
+// the first tank to ask in a step computes it; the others get the same one. tanks keep their
+// last battle info, and the T in it, so the earlier ones are pooled for their buffers and only
+// recomputed in place once nobody else holds them.
+template<typename T>
+class StepShared {
+public:
+    // the T of this snapshot sequence - compute(T&) fills it in if it isn't there yet
+    // (sequence 0: not numbered, always redone)
+    template<typename Compute>
+    std::shared_ptr<const T> get(uint64_t sequence, Compute&& compute) {
+        if (latest_ && sequence != 0 && latestSequence_ == sequence) return latest_;
+
+        std::shared_ptr<T> item;
+        for (auto& pooled : pool_) {
+            if (pooled.use_count() == 1) {
+                item = pooled;
+                break;
+            }
+        }
+        if (!item) {
+            item = std::make_shared<T>();
+            pool_.push_back(item);
+        }
+        compute(*item);
+        latest_ = item;
+        latestSequence_ = sequence;
+        return latest_;
+    }
+
+private:
+    std::shared_ptr<const T> latest_;
+    uint64_t latestSequence_ = 0;
+    std::vector<std::shared_ptr<T>> pool_;
+};
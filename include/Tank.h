@@ -9,6 +9,7 @@
 #include "MovingGameObject.h"
 #include "Position.h"
 #include "Direction.h"
+#include "TankStore.h"
 #include "common//TankAlgorithm.h"
 #include "common/ActionRequest.h"
 #include <memory>
@@ -45,6 +46,11 @@ public:
     void setNextAction(ActionRequest action);
     void setLastAction(ActionRequest action);
 
+    // moves the tank's state into a slot of the given store (the game manager's, which updates
+    // the counters of all its tanks at once). the store must outlive the tank.
+    void attachToStore(TankStore& store);
+    int getStoreSlot() const { return slot_; }
+
 
     // Actions
     bool moveForward() override;
@@ -65,10 +71,10 @@ public:
     void resetIsRightAfterMoveBack();
 
     //for creating the output file
-    bool getWasKilledThisStep() const {return wasKilledThisStep_;}
-    bool getWasLastActionIgnored() const {return wasLastActionIgnored;}
-    void setWasKilledThisStep(bool val) {wasKilledThisStep_ = val;}
-    void setWasLastActionIgnored(bool val) {wasLastActionIgnored = val;}
+    bool getWasKilledThisStep() const {return hasFlag(TankStore::KILLED_THIS_STEP);}
+    bool getWasLastActionIgnored() const {return hasFlag(TankStore::LAST_ACTION_IGNORED);}
+    void setWasKilledThisStep(bool val) {setFlag(TankStore::KILLED_THIS_STEP, val);}
+    void setWasLastActionIgnored(bool val) {setFlag(TankStore::LAST_ACTION_IGNORED, val);}
 
 
 private:
@@ -79,15 +85,14 @@ private:
 
     bool requestedBattleInfo_ = false; //not sure if neede
 
-    //shells and shoot state
-    int shellsLeft_ = SHELLS_NUMBER;
-    bool isWaitingAfterShoot_ = false; // cool down after shoot
-    int waitAfterShootCounter_ = 0;
+    //shells, shoot and moving-back state live in a TankStore slot.
+    //a tank made on its own (not by the game manager) gets a private one-slot store.
+    std::unique_ptr<TankStore> ownStore_;
+    TankStore* store_ = nullptr;
+    int slot_ = 0;
 
-    //moving-back state
-    bool isWaitingToMoveBack_ = false;
-    int waitToMoveBackCounter_ = 0;
-    bool isRightAfterMoveBack_ = false;
+    bool hasFlag(TankStore::TankFlag flag) const { return store_->hasFlag(slot_, flag); }
+    void setFlag(TankStore::TankFlag flag, bool on) { store_->setFlag(slot_, flag, on); }
 
     ActionRequest nextAction_;
     ActionRequest lastAction_;
@@ -95,11 +100,6 @@ private:
     // private methods - actions utility functions
     void actualRotateEighthLeft();
     void actualRotateEighthRight();
-
-    //for creating the output file
-    bool wasKilledThisStep_ = false;
-    bool wasLastActionIgnored = false;
-
 };
 
 #endif //TANK_H
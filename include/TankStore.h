@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// The per-step state of the tanks (cooldown counters, shells left and state flags), kept in
+// parallel arrays - one slot per tank - instead of inside each Tank object. Tank is a thin
+// handle over one slot, so the game manager can update the counters of all the tanks in one
+// tight loop (updateCounters), which the compiler vectorizes.
+class TankStore {
+public:
+    // the state flags of a tank, packed into one byte
+    enum TankFlag : uint8_t {
+        WAITING_AFTER_SHOOT   = 1 << 0,  // cool down after shoot
+        WAITING_TO_MOVE_BACK  = 1 << 1,
+        RIGHT_AFTER_MOVE_BACK = 1 << 2,
+        KILLED_THIS_STEP      = 1 << 3,  // for creating the output file
+        LAST_ACTION_IGNORED   = 1 << 4   // dido
+    };
+
+    int add(int shellsLeft);  // new slot: no flags, counters at 0. returns the slot
+    int size() const { return static_cast<int>(flags_.size()); }
+
+    bool hasFlag(int slot, TankFlag flag) const { return (flags_[slot] & flag) != 0; }
+    void setFlag(int slot, TankFlag flag, bool on) {
+        flags_[slot] = on ? static_cast<uint8_t>(flags_[slot] | flag) : static_cast<uint8_t>(flags_[slot] & ~flag);
+    }
+
+    int getWaitAfterShootCounter(int slot) const { return waitAfterShoot_[slot]; }
+    int getWaitToMoveBackCounter(int slot) const { return waitToMoveBack_[slot]; }
+    int getShellsLeft(int slot) const { return shellsLeft_[slot]; }
+    void setWaitAfterShootCounter(int slot, int turns) { waitAfterShoot_[slot] = static_cast<uint8_t>(turns); }
+    void setWaitToMoveBackCounter(int slot, int turns) { waitToMoveBack_[slot] = static_cast<uint8_t>(turns); }
+    void setShellsLeft(int slot, int shells) { shellsLeft_[slot] = shells; }
+
+    // copies one tank's state from another store (used when a tank joins the game's store)
+    void copySlot(const TankStore& from, int fromSlot, int toSlot);
+
+    // the once-per-step counters update, for every slot at once: while waiting, count down,
+    // and leave the waiting state when the counter reaches 0 (the same rules as Tank's
+    // update*Counter / resetIsWaiting* functions). dead tanks are updated too - nobody reads them.
+    void updateCounters();
+
+private:
+    std::vector<uint8_t> flags_;           // TankFlag bits
+    std::vector<uint8_t> waitAfterShoot_;  // turns, <= Tank::AFTER_SHOOT_WAIT_TURNS
+    std::vector<uint8_t> waitToMoveBack_;  // turns, <= Tank::MOVE_BACK_WAIT_TURNS
+    std::vector<int32_t> shellsLeft_;
+};
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <cstdint>
+#include "Direction.h"
+#include "Position.h"
+
+// The shape of the board as the game sees it: a torus. whatever leaves one edge comes back
+// in at the other (Position::wrap, Tank/Shell moves), so the AI measures and walks the same
+// way - an edge is never a wall, and the short way to a cell may go across one.
+// the wraps are branch-free (masks from compares, no modulo). they take coordinates at most
+// one board size off, which is all a step or a difference of two board cells can be.
+class Topology {
+public:
+    // the 4-neighbour order the searches use: right, left, down, up
+    static constexpr Direction NEIGHBOURS_4[4] = {Direction::Right, Direction::Left, Direction::Down, Direction::Up};
+
+    Topology() = default;
+    Topology(int width, int height) : width_(width), height_(height) {}
+
+    int getWidth() const { return width_; }
+    int getHeight() const { return height_; }
+    int getCellCount() const { return width_ * height_; }
+
+    int wrapX(int x) const { return wrapInto(x, width_); }
+    int wrapY(int y) const { return wrapInto(y, height_); }
+    Position wrap(Position p) const { return Position(wrapX(p.getX()), wrapY(p.getY())); }
+
+    // row-major cell index, and back. indexOf wraps, so a position one step off the board is fine
+    int indexOf(Position p) const { return wrapY(p.getY()) * width_ + wrapX(p.getX()); }
+    int indexOf(int x, int y) const { return wrapY(y) * width_ + wrapX(x); }
+    Position positionOf(int index) const {
+        int y = index / width_;
+        return Position(index - y * width_, y);
+    }
+
+    // one cell on in direction d
+    Position step(Position p, Direction d) const {
+        int i = static_cast<int>(d);
+        return Position(wrapX(p.getX() + DIRECTION_DX[i]), wrapY(p.getY() + DIRECTION_DY[i]));
+    }
+    int stepIndex(int x, int y, Direction d) const {
+        int i = static_cast<int>(d);
+        return indexOf(x + DIRECTION_DX[i], y + DIRECTION_DY[i]);
+    }
+
+    // the signed shortest way from one coordinate to another, around the ring:
+    // in [-(size-1)/2, size/2] (on an even board the half-way tie goes the positive way)
+    int deltaX(int fromX, int toX) const { return shortest(toX - fromX, width_); }
+    int deltaY(int fromY, int toY) const { return shortest(toY - fromY, height_); }
+    // how far a shell going the positive way (right/down) travels from one coordinate to the
+    // other: [0, size)
+    int forwardX(int fromX, int toX) const { return wrapInto(toX - fromX, width_); }
+    int forwardY(int fromY, int toY) const { return wrapInto(toY - fromY, height_); }
+
+    // which of the 8 directions heads toward `to` the short way (diagonal when both axes
+    // differ). Up for the same cell - check for that first when it matters
+    Direction directionTo(Position from, Position to) const {
+        int sx = sign(deltaX(from.getX(), to.getX())), sy = sign(deltaY(from.getY(), to.getY()));
+        return TOWARD[(sy + 1) * 3 + sx + 1];
+    }
+
+    // how many steps something moving in direction d from `from` takes to get to `to`: 0 for
+    // the same cell, -1 if it never does. on the torus a diagonal goes around until both axes
+    // line up, which can take up to lcm(width, height) steps
+    int stepsAlong(Position from, Direction d, Position to) const;
+    // steps before a ray in direction d comes back to the cell it started from
+    int rayLength(Direction d) const;
+    // the rays of a direction split the board into closed lines (rows, columns, and on the torus
+    // gcd(width, height) lines per diagonal direction). which one p is on, and how many steps
+    // along it from the line's first cell (x or y = 0)
+    int lineOf(Position p, Direction d) const;
+    int placeOnLine(Position p, Direction d) const;
+
+private:
+    static constexpr Direction TOWARD[9] = {
+        Direction::UpLeft,   Direction::Up,   Direction::UpRight,
+        Direction::Left,     Direction::Up,   Direction::Right,
+        Direction::DownLeft, Direction::Down, Direction::DownRight
+    };
+
+    // v in [-size, 2*size) to [0, size)
+    static int wrapInto(int v, int size) {
+        v += size & -static_cast<int32_t>(v < 0);
+        v -= size & -static_cast<int32_t>(v >= size);
+        return v;
+    }
+    static int shortest(int d, int size) {
+        d = wrapInto(d, size);
+        return d - (size & -static_cast<int32_t>(d > size / 2));
+    }
+    static int sign(int v) { return (v > 0) - (v < 0); }
+
+    int width_ = 0;
+    int height_ = 0;
+};
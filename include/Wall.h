@@ -6,7 +6,7 @@
 
 class Wall : public GameObject {
 public:
-    explicit Wall(Position pos) : GameObject(pos) {}
+    explicit Wall(Position pos) : GameObject(pos, ObjectKind::Wall) {}
     static constexpr int TIMES_TO_HIT_BEFORE_GONE = 2;
 
     char getSymbol() const override { return '#'; }
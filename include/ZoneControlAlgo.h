@@ -1,18 +1,23 @@
 #pragma once
 
-#include "Board.h"
-#include "Tank.h"
-#include "Shell.h"
-#include "Mine.h"
 #include "common/ActionRequest.h"
 #include "common/TankAlgorithm.h"
 #include "MyBattleInfo.h"
+#include "ZoneWorldModel.h"
+#include "ZoneCoverIndex.h"
+#include "ShellThreatMap.h"
 #include <vector>
 #include <memory>
 #include <optional>
 
 class ZoneControlAlgo : public TankAlgorithm {
 public:
+    static constexpr int DODGE_STEPS = 3;  // we get out of the way of shells this many steps away
+    static constexpr int UPDATE_INTERVAL = 4; // Update every 4 turns
+    // the battle info is used for up to UPDATE_INTERVAL turns, so its threat map must look that
+    // much further ahead
+    static constexpr int THREAT_HORIZON = DODGE_STEPS + UPDATE_INTERVAL;
+
     explicit ZoneControlAlgo(int tankId);
     ~ZoneControlAlgo() override = default;
 
@@ -20,11 +25,7 @@ public:
     void updateBattleInfo(BattleInfo& info) override;
 
     void updateZoneRange(int startX, int endX); // zone the tank is responsible for
-    ActionRequest decideNextAction(const Tank& self,
-                                   const Board& board,
-                                   const std::vector<std::unique_ptr<Tank>>& enemyTanks,
-                                   const std::vector<std::unique_ptr<Shell>>& shells,
-                                   const std::vector<std::unique_ptr<Mine>>& mines);
+    ActionRequest decideNextAction(const ZoneWorldModel& world);
 
 private:
     int tankId_;
@@ -32,8 +33,10 @@ private:
     int zoneEnd_;
     bool forceUpdateNextTurn_ = false;
     std::optional<MyBattleInfo> currentInfo_;
+    ZoneWorldModel world_;  // follows currentInfo_
+    ZoneCoverIndex cover_;  // of world_, in our zone
+    ShellThreatMap ownThreats_;  // when the battle info brings none
     int turnsSinceLastUpdate_;
-    static constexpr int UPDATE_INTERVAL = 4; // Update every 4 turns
     size_t lastKnownEnemyCount_;
     size_t lastKnownAllyCount_;  // Track number of ally tanks
     int totalBoardWidth_;        // Store total board width for zone calculations
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "BitFlood.h"
+#include "BitGrid.h"
+#include "Direction.h"
+#include "Position.h"
+#include "ZoneWorldModel.h"
+
+// Where a tank can take cover in its zone: the free cells next to a wall of the zone (the zone
+// is the columns zoneStart..zoneEnd, all rows; a wall outside it, or across the board edge,
+// doesn't count), and for every free cell of the zone, how many moves it is from the nearest of
+// them without leaving the zone (a BitFlood over a grid of the zone's columns only; the board
+// wraps top to bottom). queries are O(1). the index is rebuilt when the zone or a wall inside
+// it changes; wall changes outside the zone don't trigger a rebuild.
+class ZoneCoverIndex {
+public:
+    // the way (Right, Left, Down or Up) one move closer to cover from `from`. false when from
+    // is on cover already, outside the zone, or no cover can be reached from it
+    bool directionToCover(const ZoneWorldModel& world, int zoneStart, int zoneEnd, Position from, Direction& dir);
+
+private:
+    void rebuild(const ZoneWorldModel& world, int zoneStart, int zoneEnd);
+
+    // what the index was built for
+    int zoneStart_ = 0;
+    int zoneEnd_ = -1;
+    int width_ = 0;
+    int height_ = 0;
+    uint64_t wallsVersion_ = 0;    // of the zone's columns
+    bool built_ = false;
+
+    // the grids are the zone's columns (x - zoneStart_), and one more that is never free unless
+    // the zone is the whole board: BitFlood wraps left to right, the zone's sides must not meet
+    int gridWidth_ = 0;
+    BitGrid free_;                 // the zone's free cells
+    BitGrid coverBits_;
+    BitFlood flood_;
+    std::vector<int32_t> dist_;    // per grid cell, row-major: moves to cover (BitFlood::UNREACHABLE)
+};
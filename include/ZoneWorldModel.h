@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "MyBattleInfo.h"
+#include "Position.h"
+#include "Direction.h"
+#include "Topology.h"
+#include "LineOfFire.h"
+
+// What ZoneControlAlgo knows about the board, kept for the whole game and updated in place
+// from each battle info - no Board, no heap objects per turn.
+// the walls are patched from the battle info's delta when it follows the last update (a full
+// refill from the wall list otherwise). the players hand their tanks one LineOfFire for all of
+// them (MyBattleInfo::getLineOfFire); only when the battle info brings none does the model keep
+// its own, its rays patched through a changed wall with the walls. the enemy tanks change every
+// snapshot, so they live in a vector that is cleared and refilled on each update, keeping its
+// capacity (the shells are in the battle info's ShellThreatMap).
+class ZoneWorldModel {
+public:
+    void update(const MyBattleInfo& info);
+
+    // wrap like Board does (up to a board size off, see Topology)
+    bool isWall(Position pos) const { return walls_[topology_.indexOf(pos)] != 0; }
+
+    int getWidth() const { return topology_.getWidth(); }
+    int getHeight() const { return topology_.getHeight(); }
+    const Topology& getTopology() const { return topology_; }
+    // of these walls - only kept when the last battle info brought no LineOfFire of the player's
+    const LineOfFire& getLineOfFire() const { return lineOfFire_; }
+    // changes whenever a wall in columns fromX..toX appears or goes (or all the walls are refilled)
+    uint64_t getWallsVersion(int fromX, int toX) const;
+    Position getSelfPosition() const { return selfPos_; }
+    Direction getSelfDirection() const { return selfDir_; }
+    const std::vector<Position>& getEnemies() const { return enemies_; }
+
+private:
+    Topology topology_;
+    uint64_t sequence_ = 0;      // of the snapshot the walls match (0 = none)
+    std::vector<uint8_t> walls_; // one byte per cell, row-major
+    uint64_t wallsVersion_ = 0;              // counts the wall changes
+    std::vector<uint64_t> columnVersions_;   // per column: wallsVersion_ when a wall in it last changed
+    LineOfFire lineOfFire_;
+    bool lineOfFireCurrent_ = false;  // lineOfFire_ matches walls_
+
+    Position selfPos_;
+    Direction selfDir_ = Direction::Up;
+    std::vector<Position> enemies_;
+};
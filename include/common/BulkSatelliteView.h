@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include "SatelliteView.h"
+
+// Optional extension of SatelliteView, for views that keep their cells in rows: a whole row
+// or a block of the board at once, instead of one virtual getObjectAt call per cell.
+// users check for it with dynamic_cast and fall back to getObjectAt.
+class BulkSatelliteView : public SatelliteView {
+public:
+    virtual size_t getWidth() const = 0;
+    virtual size_t getHeight() const = 0;
+
+    // getWidth() chars, the same as getObjectAt(0..width-1, y). y must be < getHeight().
+    // valid as long as the view is
+    virtual const char* getRow(size_t y) const = 0;
+
+    // copies the w x h block at (x0, y0) to dst, row by row (dst holds w * h chars).
+    // cells outside the board read '&', like getObjectAt
+    virtual void copyRegion(size_t x0, size_t y0, size_t w, size_t h, char* dst) const {
+        size_t width = getWidth();
+        size_t height = getHeight();
+        size_t inside = x0 < width ? (w < width - x0 ? w : width - x0) : 0;
+        for (size_t dy = 0; dy < h; ++dy, dst += w) {
+            size_t y = y0 + dy;
+            if (y >= height) {
+                std::memset(dst, '&', w);
+                continue;
+            }
+            if (inside > 0) std::memcpy(dst, getRow(y) + x0, inside);
+            if (inside < w) std::memset(dst + inside, '&', w - inside);
+        }
+    }
+};
@@ -0,0 +1,64 @@
+#include "../include/BattlefieldSnapshot.h"
+#include "../include/Board.h"
+
+BattlefieldSnapshot::BattlefieldSnapshot(size_t width, size_t height, std::vector<char> cells, uint64_t sequence)
+        : width_(width), height_(height), sequence_(sequence),
+          storage_{std::make_shared<const std::vector<char>>(std::move(cells))} {
+    rows_.reserve(height);
+    for (size_t y = 0; y < height; ++y) rows_.push_back(storage_[0]->data() + y * width);
+
+    std::array<std::vector<Position>, SYMBOL_LIST_COUNT> lists;
+    for (size_t y = 0; y < height; ++y) {
+        for (size_t x = 0; x < width; ++x) {
+            int list = listOf(rows_[y][x]);
+            if (list >= 0) lists[list].emplace_back(static_cast<int>(x), static_cast<int>(y));
+        }
+    }
+    for (int i = 0; i < SYMBOL_LIST_COUNT; ++i) lists_[i] = std::make_shared<const std::vector<Position>>(std::move(lists[i]));
+}
+
+BattlefieldSnapshot::BattlefieldSnapshot(size_t width, size_t height, std::vector<Row> rows, SymbolLists lists,
+                                         uint64_t sequence)
+        : width_(width), height_(height), sequence_(sequence), storage_(std::move(rows)), lists_(std::move(lists)) {
+    rows_.reserve(height);
+    for (const Row& row : storage_) rows_.push_back(row->data());
+}
+
+int BattlefieldSnapshot::listOf(char symbol) {
+    switch (symbol) {
+        case '#': return WALLS;
+        case '@': return MINES;
+        case '*': return SHELLS;
+        case '1': return PLAYER1_TANKS;
+        case '2': return PLAYER2_TANKS;
+        default: return -1;
+    }
+}
+
+BattlefieldSnapshot::Row BattlefieldSnapshot::copyRowWithSelf(size_t x, size_t y) const {
+    if (y >= height_) return nullptr;
+    auto row = std::make_shared<std::vector<char>>(rows_[y], rows_[y] + width_);
+    if (x < width_) (*row)[x] = SELF;
+    return row;
+}
+
+char BattlefieldSnapshot::symbolAt(const Board& board, Position pos) {
+    if (board.isEmpty(pos)) return EMPTY;
+    CellObjects objects = board.getObjectsAt(pos);
+    if (!objects.empty()) return objects.front()->getSymbol();  //show only top object
+    return board.hasShell(pos) ? '*' : EMPTY;
+}
+
+std::shared_ptr<const BattlefieldSnapshot> BattlefieldSnapshot::capture(const Board& board) {
+    size_t width = static_cast<size_t>(board.getWidth());
+    size_t height = static_cast<size_t>(board.getHeight());
+    std::vector<char> cells(width * height, EMPTY);
+
+    char* out = cells.data();
+    for (int y = 0; y < board.getHeight(); ++y) {
+        for (int x = 0; x < board.getWidth(); ++x, ++out) {
+            *out = symbolAt(board, Position(x, y));
+        }
+    }
+    return std::make_shared<const BattlefieldSnapshot>(width, height, std::move(cells));
+}
@@ -0,0 +1,375 @@
+#include "../include/BitFlood.h"
+#include <algorithm>
+#include <utility>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define BIT_FLOOD_X86 1
+#include <immintrin.h>
+#endif
+
+namespace {
+
+constexpr int BLOCK_WORDS = BitGrid::BLOCK_WORDS;
+
+// one block of the next layer: the cells of the current row shifted one cell right and left
+// (with the bits carried over from the words next to it), and the cells of the rows above
+// and below - the ones that are passable and not reached yet. they are added to reached too.
+// returns the OR of the new words (0: nothing new in this block)
+uint64_t expandBlockScalar(const uint64_t* up, const uint64_t* cur, const uint64_t* down, const uint64_t* pass,
+                           uint64_t* reached, uint64_t* next) {
+    uint64_t any = 0;
+    for (int w = 0; w < BLOCK_WORDS; ++w) {
+        uint64_t c = cur[w];
+        uint64_t grow = (c << 1) | (cur[w - 1] >> 63) | (c >> 1) | (cur[w + 1] << 63) | up[w] | down[w];
+        uint64_t n = grow & pass[w] & ~reached[w];
+        next[w] = n;
+        reached[w] |= n;
+        any |= n;
+    }
+    return any;
+}
+
+#ifdef BIT_FLOOD_X86
+
+__attribute__((target("avx2")))
+inline __m256i load(const uint64_t* p) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+}
+
+__attribute__((target("avx2")))
+uint64_t expandBlockAVX2(const uint64_t* up, const uint64_t* cur, const uint64_t* down, const uint64_t* pass,
+                         uint64_t* reached, uint64_t* next) {
+    __m256i c = load(cur);
+    __m256i fromLeft = _mm256_or_si256(_mm256_slli_epi64(c, 1), _mm256_srli_epi64(load(cur - 1), 63));
+    __m256i fromRight = _mm256_or_si256(_mm256_srli_epi64(c, 1), _mm256_slli_epi64(load(cur + 1), 63));
+    __m256i grow = _mm256_or_si256(_mm256_or_si256(fromLeft, fromRight), _mm256_or_si256(load(up), load(down)));
+    __m256i r = load(reached);
+    __m256i n = _mm256_and_si256(_mm256_andnot_si256(r, grow), load(pass));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(next), n);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(reached), _mm256_or_si256(r, n));
+    return _mm256_testz_si256(n, n) ? 0 : 1;
+}
+
+#endif // BIT_FLOOD_X86
+
+// cells reached in the rows above or below that are passable and not reached in this one yet
+// are reached now. returns whether there were any
+bool spreadRowScalar(const uint64_t* up, const uint64_t* down, const uint64_t* pass, uint64_t* row, int words) {
+    uint64_t any = 0;
+    for (int w = 0; w < words; ++w) {
+        uint64_t n = (up[w] | down[w]) & pass[w] & ~row[w];
+        row[w] |= n;
+        any |= n;
+    }
+    return any != 0;
+}
+
+#ifdef BIT_FLOOD_X86
+
+__attribute__((target("avx2")))
+bool spreadRowAVX2(const uint64_t* up, const uint64_t* down, const uint64_t* pass, uint64_t* row, int words) {
+    __m256i any = _mm256_setzero_si256();
+    for (int w = 0; w < words; w += BLOCK_WORDS) {  // rows are whole blocks
+        __m256i r = load(row + w);
+        __m256i n = _mm256_andnot_si256(r, _mm256_and_si256(_mm256_or_si256(load(up + w), load(down + w)), load(pass + w)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(row + w), _mm256_or_si256(r, n));
+        any = _mm256_or_si256(any, n);
+    }
+    return !_mm256_testz_si256(any, any);
+}
+
+#endif // BIT_FLOOD_X86
+
+// g spread along the runs of set bits of p it is in, towards higher / lower bits, within a word
+// (occluded fill: log2(64) shift steps, each run doubling the distance covered)
+inline uint64_t fillUp(uint64_t g, uint64_t p) {
+    g |= p & (g << 1);  p &= p << 1;
+    g |= p & (g << 2);  p &= p << 2;
+    g |= p & (g << 4);  p &= p << 4;
+    g |= p & (g << 8);  p &= p << 8;
+    g |= p & (g << 16); p &= p << 16;
+    return g | (p & (g << 32));
+}
+
+inline uint64_t fillDown(uint64_t g, uint64_t p) {
+    g |= p & (g >> 1);  p &= p >> 1;
+    g |= p & (g >> 2);  p &= p >> 2;
+    g |= p & (g >> 4);  p &= p >> 4;
+    g |= p & (g >> 8);  p &= p >> 8;
+    g |= p & (g >> 16); p &= p >> 16;
+    return g | (p & (g >> 32));
+}
+
+// a row's cells spread over the whole runs of passable cells they are in: up the row carrying
+// across words, then down, then once more if a run goes on around the torus edge
+void fillRow(uint64_t* row, const uint64_t* pass, int words, int width) {
+    int last = width - 1;
+    int lastWord = last >> 6;
+    uint64_t lastBit = uint64_t(1) << (last & 63);
+    for (int round = 0; round < 2; ++round) {
+        uint64_t carry = 0;
+        for (int w = 0; w < words; ++w) {
+            row[w] = fillUp(row[w] | (carry & pass[w]), pass[w]);
+            carry = row[w] >> 63;
+        }
+        carry = 0;
+        for (int w = words - 1; w >= 0; --w) {
+            row[w] = fillDown(row[w] | ((carry << 63) & pass[w]), pass[w]);
+            carry = row[w] & 1;
+        }
+
+        bool first = row[0] & 1, lastSet = row[lastWord] & lastBit;
+        if (first && !lastSet && (pass[lastWord] & lastBit)) {
+            row[lastWord] |= lastBit;
+        } else if (lastSet && !first && (pass[0] & 1)) {
+            row[0] |= 1;
+        } else {
+            break;
+        }
+    }
+}
+
+void setBit(uint64_t* mask, int bit) {
+    mask[bit >> 6] |= uint64_t(1) << (bit & 63);
+}
+
+// the rows' frontier blocks and the blocks right and left of them (a cell at the edge of a
+// block reaches into the next one), up to blockCount. the torus edge is not here - see expandRowEdges
+void candidateBlocks(const uint64_t* a, const uint64_t* b, const uint64_t* c, int maskWords, int blockCount,
+                     uint64_t* out) {
+    for (int i = 0; i < maskWords; ++i) out[i] = a[i] | b[i] | c[i];
+    uint64_t carryUp = 0;
+    for (int i = 0; i < maskWords; ++i) {
+        uint64_t m = out[i];
+        uint64_t fromBelow = i + 1 < maskWords ? out[i + 1] << 63 : 0;
+        out[i] = m | (m << 1) | carryUp | (m >> 1) | fromBelow;
+        carryUp = m >> 63;
+    }
+    if (blockCount & 63) out[maskWords - 1] &= (uint64_t(1) << (blockCount & 63)) - 1;
+}
+
+// the torus, left and right: the last column steps right onto the first, the first left onto
+// the last. returns which of the two got a new cell (bit 0: the first column, bit 1: the last)
+int expandRowEdges(const uint64_t* cur, const uint64_t* pass, uint64_t* reached, uint64_t* next, int width) {
+    int last = width - 1;
+    int lastWord = last >> 6;
+    uint64_t n = ((cur[lastWord] >> (last & 63)) & 1) & pass[0] & ~reached[0];
+    next[0] |= n;
+    reached[0] |= n;
+    uint64_t m = ((cur[0] & 1) << (last & 63)) & pass[lastWord] & ~reached[lastWord];
+    next[lastWord] |= m;
+    reached[lastWord] |= m;
+    return (n ? 1 : 0) | (m ? 2 : 0);
+}
+
+void writeDistances(const uint64_t* bits, const uint64_t* blocks, int maskWords, int32_t* distRow, int32_t dist) {
+    for (int i = 0; i < maskWords; ++i) {
+        for (uint64_t m = blocks[i]; m; m &= m - 1) {
+            int first = (i * 64 + __builtin_ctzll(m)) * BLOCK_WORDS;
+            for (int w = first; w < first + BLOCK_WORDS; ++w) {
+                for (uint64_t b = bits[w]; b; b &= b - 1) distRow[w * 64 + __builtin_ctzll(b)] = dist;
+            }
+        }
+    }
+}
+
+} // namespace
+
+BitFlood::Kernel BitFlood::bestKernel() {
+#ifdef BIT_FLOOD_X86
+    static const Kernel best = __builtin_cpu_supports("avx2") ? Kernel::AVX2 : Kernel::Scalar;
+    return best;
+#else
+    return Kernel::Scalar;
+#endif
+}
+
+bool BitFlood::isSupported(Kernel kernel) {
+    return static_cast<int>(kernel) <= static_cast<int>(bestKernel());
+}
+
+const char* BitFlood::kernelName(Kernel kernel) {
+    return kernel == Kernel::AVX2 ? "avx2" : "scalar";
+}
+
+void BitFlood::prepare(int width, int height, int blocksPerRow) {
+    if (reached_.getWidth() != width || reached_.getHeight() != height) {
+        reached_.reset(width, height);
+        frontier_.reset(width, height);
+        next_.reset(width, height);
+        maskWords_ = (blocksPerRow + 63) / 64;
+        frontierBlocks_.assign(static_cast<size_t>(maskWords_) * height, 0);
+        nextBlocks_.assign(frontierBlocks_.size(), 0);
+        candidates_.assign(maskWords_, 0);
+        rowStamp_.assign(height, 0);
+        stamp_ = 0;
+    } else {
+        // frontier_ and next_ are left clear by the last fill
+        reached_.clear();
+    }
+}
+
+void BitFlood::distances(const BitGrid& passable, const BitGrid& sources, std::vector<int32_t>& dist) {
+    int width = passable.getWidth();
+    int height = passable.getHeight();
+    int words = passable.getWordsPerRow();
+    dist.assign(static_cast<size_t>(width) * height, UNREACHABLE);
+    if (width == 0 || height == 0) return;
+    prepare(width, height, passable.getBlocksPerRow());
+
+    frontierRows_.clear();
+    for (int y = 0; y < height; ++y) {
+        bool any = false;
+        for (int w = 0; w < words; ++w) {
+            uint64_t start = sources.row(y)[w] & passable.row(y)[w];
+            if (!start) continue;
+            frontier_.row(y)[w] = start;
+            reached_.row(y)[w] = start;
+            setBit(blocksOf(frontierBlocks_, y), w / BLOCK_WORDS);
+            any = true;
+        }
+        if (any) {
+            frontierRows_.push_back(y);
+            writeDistances(frontier_.row(y), blocksOf(frontierBlocks_, y), maskWords_, &dist[static_cast<size_t>(y) * width], 0);
+        }
+    }
+
+    for (int32_t layer = 1; !frontierRows_.empty(); ++layer) {
+        expandLayer(passable);
+        for (int y : nextRows_) {
+            writeDistances(next_.row(y), blocksOf(nextBlocks_, y), maskWords_, &dist[static_cast<size_t>(y) * width], layer);
+        }
+
+        // the old frontier becomes the next layer's buffer: clear the blocks it used
+        for (int y : frontierRows_) {
+            uint64_t* blocks = blocksOf(frontierBlocks_, y);
+            for (int i = 0; i < maskWords_; ++i) {
+                for (uint64_t m = blocks[i]; m; m &= m - 1) {
+                    uint64_t* block = frontier_.row(y) + (i * 64 + __builtin_ctzll(m)) * BLOCK_WORDS;
+                    std::fill(block, block + BLOCK_WORDS, 0);
+                }
+                blocks[i] = 0;
+            }
+        }
+        std::swap(frontier_, next_);
+        std::swap(frontierBlocks_, nextBlocks_);
+        std::swap(frontierRows_, nextRows_);
+    }
+}
+
+void BitFlood::expandLayer(const BitGrid& passable) {
+    int width = passable.getWidth();
+    int height = passable.getHeight();
+    int lastBlock = ((width - 1) >> 6) / BLOCK_WORDS;
+    if (++stamp_ == 0) {
+        std::fill(rowStamp_.begin(), rowStamp_.end(), 0);
+        stamp_ = 1;
+    }
+
+    // only the rows of the frontier and their neighbours can get new cells
+    nextRows_.clear();
+    auto wrapRow = [height](int y) { return y < 0 ? y + height : y >= height ? y - height : y; };
+    for (int frontierRow : frontierRows_) {
+        for (int dy = -1; dy <= 1; ++dy) {
+            int y = wrapRow(frontierRow + dy);
+            if (rowStamp_[y] == stamp_) continue;
+            rowStamp_[y] = stamp_;
+
+            int above = wrapRow(y - 1);
+            int below = wrapRow(y + 1);
+            const uint64_t* up = frontier_.row(above);
+            const uint64_t* cur = frontier_.row(y);
+            const uint64_t* down = frontier_.row(below);
+            const uint64_t* pass = passable.row(y);
+            uint64_t* reached = reached_.row(y);
+            uint64_t* next = next_.row(y);
+            uint64_t* nextBlocks = blocksOf(nextBlocks_, y);
+            bool any = false;
+
+            candidateBlocks(blocksOf(frontierBlocks_, above), blocksOf(frontierBlocks_, y),
+                            blocksOf(frontierBlocks_, below), maskWords_, passable.getBlocksPerRow(),
+                            candidates_.data());
+            for (int i = 0; i < maskWords_; ++i) {
+                for (uint64_t m = candidates_[i]; m; m &= m - 1) {
+                    int block = i * 64 + __builtin_ctzll(m);
+                    int w = block * BLOCK_WORDS;
+                    uint64_t grown;
+#ifdef BIT_FLOOD_X86
+                    if (kernel_ == Kernel::AVX2) {
+                        grown = expandBlockAVX2(up + w, cur + w, down + w, pass + w, reached + w, next + w);
+                    } else
+#endif
+                    {
+                        grown = expandBlockScalar(up + w, cur + w, down + w, pass + w, reached + w, next + w);
+                    }
+                    if (grown) {
+                        setBit(nextBlocks, block);
+                        any = true;
+                    }
+                }
+            }
+
+            int edges = expandRowEdges(cur, pass, reached, next, width);
+            if (edges & 1) setBit(nextBlocks, 0);
+            if (edges & 2) setBit(nextBlocks, lastBlock);
+            if (any || edges) nextRows_.push_back(y);
+        }
+    }
+}
+
+void BitFlood::reachable(const BitGrid& passable, const BitGrid& sources, BitGrid& reached) {
+    int width = passable.getWidth();
+    int height = passable.getHeight();
+    int words = passable.getWordsPerRow();
+    if (reached.getWidth() != width || reached.getHeight() != height) {
+        reached.reset(width, height);
+    } else {
+        reached.clear();
+    }
+    if (width == 0 || height == 0) return;
+    rowQueue_.resize(height);
+    rowQueued_.assign(height, 0);
+    int head = 0, queued = 0;
+    auto push = [&](int y) {
+        if (rowQueued_[y]) return;
+        rowQueued_[y] = 1;
+        rowQueue_[(head + queued++) % height] = y;
+    };
+
+    for (int y = 0; y < height; ++y) {
+        uint64_t* row = reached.row(y);
+        uint64_t any = 0;
+        for (int w = 0; w < words; ++w) {
+            row[w] = sources.row(y)[w] & passable.row(y)[w];
+            any |= row[w];
+        }
+        if (!any) continue;
+        fillRow(row, passable.row(y), words, width);
+        push((y + height - 1) % height);
+        push((y + 1) % height);
+    }
+
+    while (queued > 0) {
+        int y = rowQueue_[head];
+        head = (head + 1) % height;
+        queued--;
+        rowQueued_[y] = 0;
+
+        int above = (y + height - 1) % height;
+        int below = (y + 1) % height;
+        uint64_t* row = reached.row(y);
+        bool grew;
+#ifdef BIT_FLOOD_X86
+        if (kernel_ == Kernel::AVX2) {
+            grew = spreadRowAVX2(reached.row(above), reached.row(below), passable.row(y), row, words);
+        } else
+#endif
+        {
+            grew = spreadRowScalar(reached.row(above), reached.row(below), passable.row(y), row, words);
+        }
+        if (!grew) continue;
+        fillRow(row, passable.row(y), words, width);
+        push(above);
+        push(below);
+    }
+}
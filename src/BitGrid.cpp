@@ -0,0 +1,14 @@
+#include "../include/BitGrid.h"
+#include <algorithm>
+
+void BitGrid::reset(int width, int height) {
+    width_ = width;
+    height_ = height;
+    wordsPerRow_ = ((width + 63) / 64 + BLOCK_WORDS - 1) / BLOCK_WORDS * BLOCK_WORDS;
+    stride_ = wordsPerRow_ + 2;
+    words_.assign(static_cast<size_t>(stride_) * height, 0);
+}
+
+void BitGrid::clear() {
+    std::fill(words_.begin(), words_.end(), 0);
+}
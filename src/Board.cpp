@@ -1,58 +1,224 @@
 #include "../include/Board.h"
 #include <algorithm>
+#include <unordered_set>
 
-Board::Board(int w, int h) : width_(w), height_(h) {
-    grid.resize(height_, std::vector<std::vector<GameObject*>>(width_));
+Board::Board(int w, int h)
+    : width_(w), height_(h),
+      cells_(static_cast<size_t>(w) * h, nullptr),
+      occupancy_(static_cast<size_t>(w) * h, CELL_EMPTY),
+      wallHp_(static_cast<size_t>(w) * h, 0),
+      shellCount_(static_cast<size_t>(w) * h, 0) {}
+
+// WHICH OCCUPANCY BIT AN OBJECT SETS
+
+// the CELL_* bits follow the ObjectKind order, so this is a single shift
+uint8_t Board::occupancyBitFor(const GameObject& obj)
+{
+    return static_cast<uint8_t>(1u << static_cast<unsigned>(obj.getKind()));
 }
 
-Board::~Board() {
-    for (int y = 0; y < height_; ++y) {
-        for (int x = 0; x < width_; ++x) {
-            for (GameObject* obj : grid[y][x]) {
-                //delete obj;  // Only if Board owns the objects
-            }
-            grid[y][x].clear();
+// rebuild the occupancy byte (and wall hp) of a cell from the objects that are in it
+void Board::refreshOccupancy(int index)
+{
+    uint8_t bits = CELL_EMPTY;
+    uint8_t hp = 0;
+    auto account = [&](GameObject* obj) {
+        uint8_t bit = occupancyBitFor(*obj);
+        if (bit == CELL_WALL) {
+            if (obj->isDestroyed()) return; // a broken wall waiting for cleanup does not block anything
+            hp = static_cast<uint8_t>(static_cast<Wall*>(obj)->getLifeLeft());
         }
+        bits |= bit;
+    };
+
+    if (occupancy_[index] & CELL_MULTI) {
+        for (GameObject* obj : multiOccupants_[index]) account(obj);
+        bits |= CELL_MULTI;
+    } else if (cells_[index]) {
+        account(cells_[index]);
+    }
+    if (shellCount_[index] > 0) bits |= CELL_SHELL;
+    occupancy_[index] = bits;
+    wallHp_[index] = hp;
+}
+
+// PUT / TAKE AN OBJECT IN A CELL (occupancy is refreshed by the callers)
+
+void Board::attach(GameObject* obj, int index)
+{
+    if (occupancy_[index] & CELL_MULTI) {
+        multiOccupants_[index].push_back(obj);
+    } else if (cells_[index]) {
+        // second object in this cell - move both to the side table, keeping insertion order
+        multiOccupants_[index] = {cells_[index], obj};
+        cells_[index] = nullptr;
+        occupancy_[index] |= CELL_MULTI;
+    } else {
+        cells_[index] = obj;
     }
 }
 
-// ADD GAME OBJECT TO VECTOR IN CELL
+// O(1): a cell holds a handful of objects at most, and the removed one is
+// swapped with the last one instead of shifting the rest.
+// returns false if the object was not in the cell.
+bool Board::detach(GameObject* obj, int index)
+{
+    if (!(occupancy_[index] & CELL_MULTI)) {
+        if (cells_[index] != obj) return false;
+        cells_[index] = nullptr;
+        return true;
+    }
+
+    auto& objects = multiOccupants_[index];
+    auto it = std::find(objects.begin(), objects.end(), obj);
+    if (it == objects.end()) return false;
+    *it = objects.back();
+    objects.pop_back();
+
+    if (objects.size() == 1) {
+        // back to a single occupant - store it inline again
+        cells_[index] = objects.front();
+        multiOccupants_.erase(index);
+        occupancy_[index] &= ~CELL_MULTI;
+    }
+    return true;
+}
 
+// ADD GAME OBJECT TO A CELL
 
 void Board::addGameObject(GameObject* obj, Position pos)
 {
-    pos.wrap(width_, height_); //maybe not neeeded. note: the function gets a copy of "pos", so this does not change the original Position
     // Board stores raw pointers — caller owns the unique_ptr
-    grid[pos.getY()][pos.getX()].push_back(obj); // adds the object to the end of the vector at the specified cell; just store pointer, no ownership!
+    int index = indexOf(pos);
+    attach(obj, index);
+    refreshOccupancy(index);
+    notify(BoardChangeKind::ObjectAdded, obj->getKind(), index);
 }
 
 
-// GET  A VECTOR OF GAME 0BJECTS IN A CELL
+// GET THE GAME 0BJECTS IN A CELL
 
-// the meaning of the first "const": the function returns a reference to a vector of pointers to GameObject,
-// and you are not allowed to change the vector itself (add/remove/etc).
-// the meaning of the first "const": This method does not modify the Board object.
-const std::vector<GameObject*>& Board::getObjectsAt(Position pos) const
+// returns a view, not a copy. empty or not — it's fine.
+CellObjects Board::getObjectsAt(Position pos) const
 {
-    pos.wrap(width_, height_); //maybe not neeeded. note: the function gets a copy of "pos", so this does not change the original Position
-    return grid[pos.getY()][pos.getX()]; // return the vector — empty or not — it's fine.
-
+    int index = indexOf(pos);
+    if (occupancy_[index] & CELL_MULTI) {
+        const auto& objects = multiOccupants_.at(index);
+        return {objects.data(), objects.data() + objects.size()};
+    }
+    GameObject* const* begin = &cells_[index];
+    return {begin, begin + (cells_[index] ? 1 : 0)};
 }
 
-// REMOVE VECTOR IN CELL
+// REMOVE ALL OBJECTS IN CELL
 
 void Board::removeAllAt(Position pos) {
-    pos.wrap(width_, height_); //maybe not neeeded. note: the function gets a copy of "pos", so this does not change the original Position
-    grid[pos.getY()][pos.getX()].clear();  // Just drop all pointers
+    int index = indexOf(pos);
+    multiOccupants_.erase(index);
+    cells_[index] = nullptr;  // Just drop all pointers
+    occupancy_[index] = CELL_EMPTY;
+    wallHp_[index] = 0;
+    shellCount_[index] = 0;
+    notify(BoardChangeKind::CellCleared, ObjectKind::Wall, index);
 }
 
-// REMOVE A SPECIFIC OBJECT IN A CELL'S VECTOR
+// REMOVE A SPECIFIC OBJECT IN A CELL
 
 void Board::removeObject(GameObject* objToRemove, Position pos) {
-    pos.wrap(width_, height_); //maybe not neeeded. note: the function gets a copy of "pos", so this does not change the original Position
-    auto& cell = grid[pos.getY()][pos.getX()];
-    cell.erase(
-            std::remove(cell.begin(), cell.end(), objToRemove),
-            cell.end()
-    );
-}
\ No newline at end of file
+    int index = indexOf(pos);
+    if (!detach(objToRemove, index)) return;
+    refreshOccupancy(index);
+    ObjectKind kind = objToRemove->getKind();
+    bool triggered = kind == ObjectKind::Mine && objToRemove->isDestroyed();
+    notify(triggered ? BoardChangeKind::MineTriggered : BoardChangeKind::ObjectRemoved, kind, index);
+}
+
+// MOVE AN OBJECT FROM ONE CELL TO ANOTHER
+
+// every mover (shells, tanks) goes through here, so a cell never keeps a pointer
+// to an object that already left it
+void Board::moveObject(GameObject* obj, Position from, Position to) {
+    int fromIndex = indexOf(from);
+    int toIndex = indexOf(to);
+    if (fromIndex == toIndex) return;
+
+    if (detach(obj, fromIndex)) refreshOccupancy(fromIndex);
+    attach(obj, toIndex);
+    refreshOccupancy(toIndex);
+    notify(BoardChangeKind::ObjectMoved, obj->getKind(), fromIndex, toIndex);
+}
+
+// SHELLS IN FLIGHT
+
+void Board::addShell(Position pos) {
+    int index = indexOf(pos);
+    shellCount_[index]++;
+    occupancy_[index] |= CELL_SHELL;
+    notify(BoardChangeKind::ShellAdded, ObjectKind::Shell, index);
+}
+
+void Board::removeShell(Position pos) {
+    int index = indexOf(pos);
+    if (shellCount_[index] == 0) return;
+    if (--shellCount_[index] == 0) refreshOccupancy(index); // a shell object may still be in the cell
+    notify(BoardChangeKind::ShellRemoved, ObjectKind::Shell, index);
+}
+
+void Board::moveShell(Position from, Position to) {
+    int fromIndex = indexOf(from);
+    int toIndex = indexOf(to);
+    if (shellCount_[fromIndex] > 0 && --shellCount_[fromIndex] == 0) refreshOccupancy(fromIndex);
+    shellCount_[toIndex]++;
+    occupancy_[toIndex] |= CELL_SHELL;
+    notify(BoardChangeKind::ShellMoved, ObjectKind::Shell, fromIndex, toIndex);
+}
+
+// HIT A WALL
+
+bool Board::hitWall(Wall& wall) {
+    wall.decreaseLifeLeft();
+    int index = indexOf(wall.getPosition());
+    refreshOccupancy(index);
+    bool destroyed = wall.isDestroyed();
+    notify(destroyed ? BoardChangeKind::WallDestroyed : BoardChangeKind::WallDamaged, ObjectKind::Wall, index);
+    return destroyed;
+}
+
+// CONSISTENCY CHECK (debug only - O(cells))
+
+// every object must sit in the cell of its (wrapped) position, appear only once,
+// and the occupancy planes must match the objects that are really there.
+bool Board::checkConsistency(std::string* problem) const {
+    auto fail = [&](const std::string& what, int index) {
+        if (problem) {
+            *problem = what + " at (" + std::to_string(index % width_) + "," +
+                       std::to_string(index / width_) + ")";
+        }
+        return false;
+    };
+
+    std::unordered_set<const GameObject*> seen;
+    for (int index = 0; index < width_ * height_; ++index) {
+        bool multi = (occupancy_[index] & CELL_MULTI) != 0;
+        auto entry = multiOccupants_.find(index);
+        if (multi != (entry != multiOccupants_.end())) return fail("side table out of sync", index);
+        if (multi && cells_[index]) return fail("crowded cell also has an inline object", index);
+        if (multi && entry->second.size() < 2) return fail("side table entry with less than 2 objects", index);
+
+        uint8_t bits = multi ? CELL_MULTI : CELL_EMPTY;
+        uint8_t hp = 0;
+        for (GameObject* obj : getObjectsAt({index % width_, index / width_})) {
+            if (!seen.insert(obj).second) return fail("object registered twice", index);
+            if (indexOf(obj->getPosition()) != index) return fail("object registered in the wrong cell", index);
+            if (obj->getKind() == ObjectKind::Wall) {
+                if (obj->isDestroyed()) continue;
+                hp = static_cast<uint8_t>(static_cast<const Wall*>(obj)->getLifeLeft());
+            }
+            bits |= occupancyBitFor(*obj);
+        }
+        if (shellCount_[index] > 0) bits |= CELL_SHELL;
+        if (bits != occupancy_[index]) return fail("occupancy bits out of sync", index);
+        if (hp != wallHp_[index]) return fail("wall hp out of sync", index);
+    }
+    return true;
+}
@@ -0,0 +1,87 @@
+#include "../include/DistanceField.h"
+
+namespace {
+    // the rotations, as actions and as 45 degree steps to the right
+    constexpr int ROTATION_COUNT = 4;
+    constexpr ActionRequest ROTATIONS[ROTATION_COUNT] = {
+        ActionRequest::RotateRight45, ActionRequest::RotateLeft45,
+        ActionRequest::RotateRight90, ActionRequest::RotateLeft90
+    };
+    constexpr int ROTATION_EIGHTHS[ROTATION_COUNT] = {1, -1, 2, -2};
+
+    // the transitions between directions, precomputed (enum values):
+    // rotated[d][r] is d after rotation r, turnedFrom[d][r] the direction rotation r turns into d
+    struct RotationTables {
+        int rotated[DIRECTION_COUNT][ROTATION_COUNT];
+        int turnedFrom[DIRECTION_COUNT][ROTATION_COUNT];
+    };
+
+    constexpr RotationTables makeRotationTables() {
+        RotationTables t{};
+        for (int d = 0; d < DIRECTION_COUNT; ++d) {
+            for (int r = 0; r < ROTATION_COUNT; ++r) {
+                t.rotated[d][r] = static_cast<int>(rotateDirection(static_cast<Direction>(d), ROTATION_EIGHTHS[r]));
+                t.turnedFrom[d][r] = static_cast<int>(rotateDirection(static_cast<Direction>(d), -ROTATION_EIGHTHS[r]));
+            }
+        }
+        return t;
+    }
+
+    constexpr RotationTables ROTATION_TABLES = makeRotationTables();
+}
+
+void DistanceField::compute(const BattlefieldSnapshot& snapshot, const std::vector<Position>& sources) {
+    topology_ = Topology(static_cast<int>(snapshot.getWidth()), static_cast<int>(snapshot.getHeight()));
+    const int width = topology_.getWidth();
+    sequence_ = snapshot.getSequence();
+    dist_.assign(static_cast<size_t>(topology_.getCellCount()) * DIRECTION_COUNT, UNREACHABLE);
+    queue_.resize(dist_.size());
+
+    // arriving on a target cell is the goal, whatever the direction
+    int head = 0, tail = 0;
+    for (const Position& source : sources) {
+        int first = topology_.indexOf(source) * DIRECTION_COUNT;
+        if (dist_[first] != UNREACHABLE) continue;
+        for (int d = 0; d < DIRECTION_COUNT; ++d) {
+            dist_[first + d] = 0;
+            queue_[tail++] = first + d;
+        }
+    }
+
+    auto reach = [&](int state, int32_t dist) {
+        if (dist_[state] != UNREACHABLE) return;
+        dist_[state] = dist;
+        queue_[tail++] = state;
+    };
+
+    // backwards: the states that get to the current one with a single action
+    while (head < tail) {
+        int state = queue_[head++];
+        int cell = state / DIRECTION_COUNT;
+        int d = state - cell * DIRECTION_COUNT;
+        int32_t next = dist_[state] + 1;
+
+        for (int r = 0; r < ROTATION_COUNT; ++r) reach(cell * DIRECTION_COUNT + ROTATION_TABLES.turnedFrom[d][r], next);
+
+        int y = cell / width;
+        int x = cell - y * width;
+        int bx = topology_.wrapX(x - DIRECTION_DX[d]);  // facing d there, a move gets here
+        int by = topology_.wrapY(y - DIRECTION_DY[d]);
+        if (snapshot.getRow(by)[bx] != '#') reach((by * width + bx) * DIRECTION_COUNT + d, next);
+    }
+}
+
+ActionRequest DistanceField::nextActionFrom(Position pos, Direction dir) const {
+    int32_t here = distanceAt(pos, dir);
+    if (here <= 0) return ActionRequest::DoNothing;
+
+    int d = static_cast<int>(dir);
+    int ahead = topology_.stepIndex(pos.getX(), pos.getY(), dir);
+    if (dist_[ahead * DIRECTION_COUNT + d] == here - 1) return ActionRequest::MoveForward;
+
+    int cell = topology_.indexOf(pos);
+    for (int r = 0; r < ROTATION_COUNT; ++r) {
+        if (dist_[cell * DIRECTION_COUNT + ROTATION_TABLES.rotated[d][r]] == here - 1) return ROTATIONS[r];
+    }
+    return ActionRequest::DoNothing;
+}
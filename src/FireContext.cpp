@@ -0,0 +1,49 @@
+#include "../include/FireContext.h"
+
+std::shared_ptr<const FireMatrix> FireContext::matrixFor(const BattlefieldSnapshot& snapshot) {
+    return matrices_.get(snapshot.getSequence(), [&](FireMatrix& matrix) {
+        followWalls(snapshot);
+        matrix.compute(snapshot, *lineOfFire_);
+    });
+}
+
+std::shared_ptr<const LineOfFire> FireContext::lineOfFireFor(const BattlefieldSnapshot& snapshot) {
+    followWalls(snapshot);
+    return lineOfFire_;
+}
+
+void FireContext::followWalls(const BattlefieldSnapshot& snapshot) {
+    const BattlefieldSnapshot::PositionList& walls = snapshot.getSymbolLists()[BattlefieldSnapshot::WALLS];
+    if (walls == seenWalls_) return;
+
+    int width = static_cast<int>(snapshot.getWidth()), height = static_cast<int>(snapshot.getHeight());
+    if (!seenWalls_ || width != topology_.getWidth() || height != topology_.getHeight()) {
+        topology_ = Topology(width, height);
+        walls_.assign(static_cast<size_t>(width) * height, 0);
+        for (const Position& pos : *walls) walls_[topology_.indexOf(pos)] = 1;
+        lineOfFire_->build(topology_, walls_.data());
+        seenWalls_ = walls;
+        return;
+    }
+
+    // both lists are row by row: one merge finds the walls that went and the ones that came
+    const std::vector<Position>& before = *seenWalls_;
+    const std::vector<Position>& after = *walls;
+    size_t i = 0, j = 0;
+    auto flip = [&](Position pos) {
+        int cell = topology_.indexOf(pos);
+        walls_[cell] ^= 1;
+        lineOfFire_->wallChanged(walls_.data(), cell);
+    };
+    while (i < before.size() || j < after.size()) {
+        if (j == after.size() || (i < before.size() && BattlefieldSnapshot::isBefore(before[i], after[j]))) {
+            flip(before[i++]);
+        } else if (i == before.size() || BattlefieldSnapshot::isBefore(after[j], before[i])) {
+            flip(after[j++]);
+        } else {
+            ++i;
+            ++j;
+        }
+    }
+    seenWalls_ = walls;
+}
@@ -0,0 +1,74 @@
+#include "../include/FireMatrix.h"
+#include <algorithm>
+
+namespace {
+    // one direction per kind of line; the other way along it is the opposite direction
+    constexpr int LINE_KINDS = 4;
+    constexpr Direction FORWARD[LINE_KINDS] = {Direction::Right, Direction::Down, Direction::DownRight, Direction::UpRight};
+}
+
+void FireMatrix::compute(const BattlefieldSnapshot& snapshot, const LineOfFire& lineOfFire) {
+    sequence_ = snapshot.getSequence();
+    const Topology& topology = lineOfFire.getTopology();
+
+    // both players' tanks, merged back into row-major order so tankAt can search them
+    const auto& first = snapshot.getPositions(BattlefieldSnapshot::PLAYER1_TANKS);
+    const auto& second = snapshot.getPositions(BattlefieldSnapshot::PLAYER2_TANKS);
+    tanks_.clear();
+    size_t i = 0, j = 0;
+    while (i < first.size() || j < second.size()) {
+        if (j == second.size() || (i < first.size() && BattlefieldSnapshot::isBefore(first[i], second[j]))) {
+            tanks_.push_back({first[i++], 1});
+        } else {
+            tanks_.push_back({second[j++], 2});
+        }
+    }
+    const int tankCount = static_cast<int>(tanks_.size());
+    aims_.assign(static_cast<size_t>(tankCount) * DIRECTION_COUNT, Aim());
+
+    onLine_.clear();
+    for (int kind = 0; kind < LINE_KINDS; ++kind) {
+        for (int t = 0; t < tankCount; ++t) {
+            Position pos = tanks_[t].pos;
+            onLine_.push_back({kind, topology.lineOf(pos, FORWARD[kind]), topology.placeOnLine(pos, FORWARD[kind]), t});
+        }
+    }
+    std::sort(onLine_.begin(), onLine_.end());
+
+    // neighbours along a line see each other, unless a wall is between them. the line is closed,
+    // so the last tank on it sees the first one around the edge
+    size_t start = 0;
+    while (start < onLine_.size()) {
+        size_t end = start + 1;
+        while (end < onLine_.size() && onLine_[end].kind == onLine_[start].kind && onLine_[end].line == onLine_[start].line) ++end;
+        if (end - start >= 2) {
+            Direction forward = FORWARD[onLine_[start].kind];
+            Direction back = rotateDirection(forward, DIRECTION_COUNT / 2);
+            int32_t length = topology.rayLength(forward);
+            for (size_t k = start; k < end; ++k) {
+                const OnLine& from = onLine_[k];
+                const OnLine& to = k + 1 < end ? onLine_[k + 1] : onLine_[start];
+                int32_t steps = to.place - from.place;
+                if (steps <= 0) steps += length;
+                if (steps > lineOfFire.clearCells(tanks_[from.tank].pos, forward)) continue;
+                aims_[from.tank * DIRECTION_COUNT + static_cast<int>(forward)] = {to.tank, steps};
+                aims_[to.tank * DIRECTION_COUNT + static_cast<int>(back)] = {from.tank, steps};
+            }
+        }
+        start = end;
+    }
+}
+
+int FireMatrix::tankAt(Position pos) const {
+    auto it = std::lower_bound(tanks_.begin(), tanks_.end(), pos, [](const Tank& tank, Position p) {
+        return BattlefieldSnapshot::isBefore(tank.pos, p);
+    });
+    return it != tanks_.end() && it->pos == pos ? static_cast<int>(it - tanks_.begin()) : NONE;
+}
+
+bool FireMatrix::canShoot(Position from, Direction d, Position target) const {
+    int tank = tankAt(from);
+    if (tank == NONE) return false;
+    Aim a = aim(tank, d);
+    return a.tank != NONE && tanks_[a.tank].pos == target;
+}
@@ -7,6 +7,8 @@
 #include <type_traits>
 #include <algorithm>
 #include <memory>
+#include <cstdlib>
+#include <unordered_map>
 #include "MyTankAlgorithm.h"
 
 
@@ -30,6 +32,8 @@ bool GameManager::readBoard(const std::string& inputFile) {
     board_ = parser.getBoard();
     boardWidth_ = board_.getWidth();
     boardHeight_ = board_.getHeight();
+    raster_ = std::make_unique<SatelliteRaster>(board_);
+    board_.setObserver(raster_.get());
     maxSteps_ = parser.getMaxSteps();
     numShells_ = parser.getNumShells();
     walls_ = std::move(parser.getActiveWalls());
@@ -39,6 +43,20 @@ bool GameManager::readBoard(const std::string& inputFile) {
     p2Tanks_ = parser.getPlayer2Tanks();
     allTanksSorted_ = sortAllTanks(p1Tanks_, p2Tanks_);
 
+    //all the tanks keep their counters and flags in the game's store, in aliveTanks_ order
+    tankStore_ = TankStore();
+    aliveTanks_.clear();
+    for (const auto& t : p1Tanks_) aliveTanks_.push_back(t.get());
+    for (const auto& t : p2Tanks_) aliveTanks_.push_back(t.get());
+    for (Tank* t : aliveTanks_) t->attachToStore(tankStore_);
+    lastSnapshotSequence_.assign(tankStore_.size(), 0);
+
+    stats_ = GameStats();
+    for (Tank* t : aliveTanks_) {
+        stats_.aliveTanks[t->getPlayerId() - 1]++;
+        stats_.shellsLeft += t->getShellsLeft();
+    }
+
     for (size_t i = 0; i < p1Tanks_.size(); ++i) {
         auto algo = tankFactory_->create(1, static_cast<int>(i));
         p1Tanks_[i]->setAlgorithm(std::make_unique<MyTankAlgorithm>(
@@ -74,85 +92,81 @@ bool GameManager::readBoard(const std::string& inputFile) {
 }
 
 void GameManager::run() {
-    int stepCounter = 0;
+    stepCounter_ = 0;
     stepsLeftWhenShellsOver_ = STEPS_WHEN_SHELLS_OVER;
-    int p1Alive;
-    int p2Alive;
-
-    while (stepCounter < maxSteps_ && stepsLeftWhenShellsOver_ > 0) {
-        printToFile("\n--- Step " + std::to_string(stepCounter) + " ---");
-
-        //reset "setWasKilledThisStep" for all tanks
-        for (auto& t : p1Tanks_) {
+    int p1Alive = stats_.getAliveTanks(1);
+    int p2Alive = stats_.getAliveTanks(2);
+
+    while (stepCounter_ < maxSteps_ && stepsLeftWhenShellsOver_ > 0) {
+        printToFile("\n--- Step " + std::to_string(stepCounter_) + " ---");
+
+        //***counters***
+        //the cooldown counters of every tank, in one pass over the store
+        tankStore_.updateCounters();
+
+        //***decide pass***
+        //one sweep over the alive tanks: reset, decide, and drop the tank in the bucket
+        //of the phase that handles its action. the phases below only touch their own bucket.
+        clearPhaseBuckets();
+        stepSnapshot_.reset();
+        for (Tank* t : aliveTanks_) {
             t->setWasKilledThisStep(false);
-        }
 
-        for (auto& t : p2Tanks_) {
-            t->setWasKilledThisStep(false);
-        }
+            ActionRequest action = decideAction(*t, *t->getAlgorithm());
+            t->setNextAction(action);
 
-        //***counters handling***
-        for (auto& t : p1Tanks_) if (!t->isDestroyed()) countersHandler(*t);
-        for (auto& t : p2Tanks_) if (!t->isDestroyed()) countersHandler(*t);
+            if (action == ActionRequest::GetBattleInfo) battleInfoTanks_.push_back(t);
+            else if (action == ActionRequest::Shoot) shootingTanks_.push_back(t);
+            else actingTanks_.push_back(t);
 
-        //***deciding tanks actions***
-        for (auto& t : p1Tanks_) {
-            if (!t->isDestroyed()) {
-                ActionRequest action = decideAction(*t, *t->getAlgorithm());
-                t->setNextAction(action);
-            }
-        }
-
-        for (auto& t : p2Tanks_) {
-            if (!t->isDestroyed()) {
-                ActionRequest action = decideAction(*t, *t->getAlgorithm());
-                t->setNextAction(action);
-            }
+            if (t->getIsWaitingToMoveBack() && t->getWaitToMoveBackCounter() == 0) autoMoveBackTanks_.push_back(t);
         }
 
         //***handle get battle info***
         //it's first cuz the view is of the board before the current step
-        for (auto& t : p1Tanks_) if (!t->isDestroyed() && t->getNextAction() == ActionRequest::GetBattleInfo) handleRequestBattleInfo(*t);
-        for (auto& t : p2Tanks_) if (!t->isDestroyed() && t->getNextAction() == ActionRequest::GetBattleInfo) handleRequestBattleInfo(*t);
+        for (Tank* t : battleInfoTanks_) handleRequestBattleInfo(*t);
 
         //***handle shooting***
         //it's before other actions (except get battle info) cuz this is the choice we made in the game logic:
         //first, we move the shells. then, we move the tanks.
-        for (auto& t : p1Tanks_) if (!t->isDestroyed() && t->getNextAction() == ActionRequest::Shoot) handleShoot(*t);
-        for (auto& t : p2Tanks_) if (!t->isDestroyed() && t->getNextAction() == ActionRequest::Shoot) handleShoot(*t);
+        for (Tank* t : shootingTanks_) handleShoot(*t);
 
         for (int i = 0; i < shellMovesPerStep_; ++i) {
             shellStep(); //collisions are handled inside this function
-            cleanupDestroyedObjects(shells_);
+            releaseDestroyedShells();
             cleanupDestroyedObjects(walls_);
-            //cleanupDestroyedObjects(p1Tanks_); //not cleaning, it's needed for creating output file
-            //cleanupDestroyedObjects(p2Tanks_); //not cleaning, it's needed for creating output file
+            removeKilledTanksFromBoard();
             //no need to clean mines at this point. shells do not hit mines.
         }
 
         //***handle other actions (not get battle info / shoot)***
-        for (auto& t : p1Tanks_) if (!t->isDestroyed() && t->getNextAction() != ActionRequest::Shoot && t->getNextAction() != ActionRequest::GetBattleInfo) handleAction(*t, t->getNextAction());
-        for (auto& t : p2Tanks_) if (!t->isDestroyed() && t->getNextAction() != ActionRequest::Shoot && t->getNextAction() != ActionRequest::GetBattleInfo) handleAction(*t, t->getNextAction());
+        //a tank in these buckets may have been killed by a shell a moment ago
+        for (Tank* t : actingTanks_) if (!t->isDestroyed()) handleAction(*t, t->getNextAction());
 
         //***check if we need to move the tank back and move it, if yes***
-         for (auto& t : p1Tanks_) if (!t->isDestroyed()) handleAutoMoveTankBack(*t);
-         for (auto& t : p2Tanks_) if (!t->isDestroyed()) handleAutoMoveTankBack(*t);
+        for (Tank* t : autoMoveBackTanks_) if (!t->isDestroyed()) handleAutoMoveTankBack(*t);
 
         //***resolve collisions***
-        for (auto& t : p1Tanks_) if (!t->isDestroyed()) resolveTankCollisionsAtPosition(*t);
-        for (auto& t : p2Tanks_) if (!t->isDestroyed()) resolveTankCollisionsAtPosition(*t);
+        //only a tank that changed cell this step can be in a new collision (the move handlers fill movedTanks_)
+        for (Tank* t : movedTanks_) if (!t->isDestroyed()) resolveTankCollisionsAtPosition(*t);
 
-        //cleanupDestroyedObjects(p1Tanks_); //not cleaning, it's needed for creating output file
-        //cleanupDestroyedObjects(p2Tanks_); //not cleaning, it's needed for creating output file
         cleanupDestroyedObjects(mines_);
+        removeKilledTanksFromBoard();
         //no need to clean shells at this point. shells has been handled before.
         //no need to clean walls at this point, cuz tanks can not hit walls.
 
+        //the dead tanks stay in p1Tanks_/p2Tanks_ (needed for creating output file), but leave the alive list
+        compactAliveTanks();
+
+#ifdef TANKGAME_CHECK_BOARD
+        checkBoardConsistency();
+#endif
+
         if (checkIfPlayerLostAllTanks(p1Alive, p2Alive)) {break;}  //this returns true if a player, or both, lost all of his tanks.
-        //it also counts the alive tanks of each player, and keep it in p1Alive, p2Alive
+        //it also gives the alive tanks of each player, in p1Alive, p2Alive
 
         if (getTotalShellsLeft() <= 0) --stepsLeftWhenShellsOver_;
-        stepCounter++;
+        stepCounter_++;
 
         printRoundToFile();
     }
@@ -173,15 +187,23 @@ ActionRequest GameManager::decideAction(Tank& tank, TankAlgorithm& algo){
     return action;
 }
 
+//kept by handleShoot (a dead tank's shells still count)
 int GameManager::getTotalShellsLeft() const
 {
-    int total = 0;
-    for (const auto& t : p1Tanks_) total += t->getShellsLeft();
-    for (const auto& t : p2Tanks_) total += t->getShellsLeft();
-    return total;
+    return stats_.shellsLeft;
 }
 
 
+//taken on the first call of the step: the battle info phase runs before anything moves,
+//so every request of the step sees the same board. the raster only redraws what changed.
+const std::shared_ptr<const BattlefieldSnapshot>& GameManager::getStepSnapshot() {
+    if (!stepSnapshot_) {
+        stepSnapshot_ = raster_->snapshot();
+        stats_.snapshotsBuilt++;
+    }
+    return stepSnapshot_;
+}
+
 void GameManager::handleRequestBattleInfo(Tank& tank) {
     //pre-action reset and check
     tank.resetIsRightAfterMoveBack();
@@ -191,20 +213,17 @@ void GameManager::handleRequestBattleInfo(Tank& tank) {
       return;
     }
 
-    //create a 2D char representation of the board
-    std::vector<std::vector<char>> view(boardHeight_, std::vector<char>(boardWidth_, ' '));
-
-    for (size_t y = 0; y < boardHeight_; ++y) {
-        for (size_t x = 0; x < boardWidth_; ++x) {
-            const auto& objects = board_.getObjectsAt({(int)x, (int)y});
-            if (!objects.empty()) {
-                view[y][x] = objects.front()->getSymbol();  //show only top object
-            }
-        }
-    }
-
-    //create a SatelliteViewImpl from it
-    SatelliteViewImpl satellite(view);
+    //one immutable snapshot of the board per step, shared by every requesting tank (the view, the
+    //battle info and the algorithm). the tank itself is marked '%' by the view, as an overlay.
+    //the view also carries what changed since this tank's previous snapshot, when the raster still knows
+    Position self = tank.getPosition();
+    const auto& snapshot = getStepSnapshot();
+    uint64_t& lastSequence = lastSnapshotSequence_[tank.getStoreSlot()];
+    SatelliteViewImpl satellite(snapshot,
+                                {static_cast<size_t>(self.getX()), static_cast<size_t>(self.getY())},
+                                raster_->deltaSince(lastSequence));
+    lastSequence = snapshot->getSequence();
+    stats_.battleInfoServed++;
 
     //determine which player owns this tank
     int playerId = tank.getPlayerId();
@@ -232,7 +251,10 @@ void GameManager::handleShoot(Tank& tank) {
         tank.setWasLastActionIgnored(true);
         return;
     }
-    shells_.push_back(std::make_unique<Shell>(tank.getPosition(), tank.getDirection(), tank.getId()));
+    shells_.spawn(tank.getPosition(), tank.getDirection(), tank.getId());
+    board_.addShell(tank.getPosition());
+    stats_.shellsLeft--;
+    stats_.shellsFired++;
     tank.setLastAction(ActionRequest::Shoot);
     tank.setWasLastActionIgnored(false);
 }
@@ -253,84 +275,192 @@ void GameManager::handleAction(Tank& tank, ActionRequest action) {
     }
 }
 
-void GameManager::countersHandler(Tank& tank)
-{
-    tank.updateWaitToMoveBackCounter(); //decrease counter only if the tank is waiting to move back + counter>0
-    tank.resetIsWaitingToMoveBack(); //change waiting_to_move_back to false, only if the tank was in waiting state + counter==0
-
-    tank.updateWaitAfterShootCounter(); //decrease counter only if the tank is after shoot + counter>0
-    tank.resetIsWaitingAfterShoot(); //change waiting_after_shoot to false, only if the tank is after shoot + counter==0
-}
-
 void GameManager::handleAutoMoveTankBack(Tank& tank) {
     if (tank.getIsWaitingToMoveBack() && tank.getWaitToMoveBackCounter() == 0) {
         handleMoveTankBack(tank);
     }
 }
 
-void GameManager::moveForwardAndWrap(Shell& shell) {
-    shell.moveForward();
-    Position newPos = shell.getPosition();
-    newPos.wrap(boardWidth_, boardHeight_);
-    shell.setPosition(newPos);
+//all the shells move together: off the board, one vectorized advance + wrap over the
+//whole pool, and back on the board at their new cells
+void GameManager::moveAllShellsForwardAndWrap() {
+    for (int slot = 0; slot < shells_.slotCount(); ++slot) {
+        if (shells_.isAlive(slot)) board_.removeShell(shells_.getPosition(slot));
+    }
+    shells_.advanceAll(boardWidth_, boardHeight_);
+    for (int slot = 0; slot < shells_.slotCount(); ++slot) {
+        if (shells_.isAlive(slot)) board_.addShell(shells_.getPosition(slot));
+    }
 }
 
+//shells live in one pool, so every pass is a linear walk over its slots:
+//1. shells whose moves cross (head-on swaps, crossing diagonals) - found before moving
+//2. move all shells
+//3. crossing shells die on the way, so they never reach walls or tanks
+//4. the rest hit whatever is in their new cell
+//5. live shells that ended in the same cell destroy each other
 void GameManager::shellStep() {
-    for (auto& shell : shells_) {
-        moveForwardAndWrap(*shell);
-        board_.addGameObject(shell.get(), shell->getPosition());
-    }
+    crossedShells_ = shellCollisionFinder_.findCrossings(shells_, boardWidth_, boardHeight_); //kept, the finder reuses its list
 
-    for (auto& shell : shells_) {
-        if (!shell->isDestroyed()) {
-            resolveShellCollisionsAtPosition(*shell);
+    moveAllShellsForwardAndWrap();
+
+    destroyCollidedShells(crossedShells_);
+
+    for (int slot = 0; slot < shells_.slotCount(); ++slot) {
+        if (shells_.isAlive(slot)) {
+            resolveShellCollisionsAtPosition(slot);
         }
     }
+
+    destroyCollidedShells(shellCollisionFinder_.findSharedCells(shells_, boardWidth_));
 }
 
-void GameManager::resolveShellCollisionsAtPosition(Shell& shell) {
-    Position pos = shell.getPosition();
+void GameManager::resolveShellCollisionsAtPosition(int shellSlot) {
+    Position pos = shells_.getPosition(shellSlot);
     const auto& objects = board_.getObjectsAt(pos);
     for (const auto& obj : objects) {
-        if (auto* wall = dynamic_cast<Wall*>(obj)) {
-            wall->decreaseLifeLeft();
-            shell.destroy();
-        } else if (auto* anotherShell = dynamic_cast<Shell*>(obj)) {
-            anotherShell->destroy();
-            shell.destroy();
-        } else if (auto* tank = dynamic_cast<Tank*>(obj)) {
-            tank->destroy();
-            tank->setWasKilledThisStep(true);
-            shell.destroy();
-        }
+        applyShellCollision(shellSlot, *obj);
     }
 }
 
+//shell vs shell - every slot in the list met another shell (the pairs are found by ShellCollisionFinder)
+void GameManager::destroyCollidedShells(const std::vector<int>& shellSlots) {
+    if (!(CollisionTable::lookup(ObjectKind::Shell, ObjectKind::Shell) & COLLIDE_DESTROY_MOVER)) return;
+    for (int slot : shellSlots) shells_.destroy(slot);
+}
+
+//same rules as applyCollision, for a mover that lives in the shell pool
+void GameManager::applyShellCollision(int shellSlot, GameObject& other) {
+    uint8_t effect = CollisionTable::lookup(ObjectKind::Shell, other.getKind());
+    if (effect == COLLIDE_NOTHING) return;
+
+    if (effect & COLLIDE_DAMAGE_OTHER) board_.hitWall(static_cast<Wall&>(other));
+    if (effect & COLLIDE_DESTROY_OTHER) destroyObject(other);
+    if (effect & COLLIDE_DESTROY_MOVER) shells_.destroy(shellSlot);
+}
+
+//take the destroyed shells off the board and give their slots back to the pool
+void GameManager::releaseDestroyedShells() {
+    shells_.releaseDestroyed([&](int slot) { board_.removeShell(shells_.getPosition(slot)); });
+    if (shells_.isSparse()) shells_.compact();
+}
+
 void GameManager::resolveTankCollisionsAtPosition(Tank& tank) {
     Position pos = tank.getPosition();
     const auto& objects = board_.getObjectsAt(pos);
     for (const auto& obj : objects) {
-        if (auto* mine = dynamic_cast<Mine*>(obj)) {
-            mine->destroy();
-            tank.destroy();
-            tank.setWasKilledThisStep(true);
-        } else if (auto* anotherTank = dynamic_cast<Tank*>(obj)) {
-            if (anotherTank != &tank) {
-                anotherTank->destroy();
-                anotherTank->setWasKilledThisStep(true);
-                tank.destroy();
-                tank.setWasKilledThisStep(true);
-            }
+        applyCollision(tank, *obj);
+    }
+}
+
+//one table lookup per pair - the rules themselves are in CollisionTable.h
+void GameManager::applyCollision(GameObject& mover, GameObject& other) {
+    if (&mover == &other) return; //the mover is in its own cell too
+
+    uint8_t effect = CollisionTable::lookup(mover.getKind(), other.getKind());
+    if (effect == COLLIDE_NOTHING) return;
+
+    if (effect & COLLIDE_DAMAGE_OTHER) board_.hitWall(static_cast<Wall&>(other));
+    if (effect & COLLIDE_DESTROY_OTHER) destroyObject(other);
+    if (effect & COLLIDE_DESTROY_MOVER) destroyObject(mover);
+}
+
+void GameManager::destroyObject(GameObject& obj) {
+    if (obj.getKind() == ObjectKind::Tank) {
+        Tank& tank = static_cast<Tank&>(obj);
+        tank.setWasKilledThisStep(true);
+        //a tank can be hit twice in one step (e.g. two shells), count its death once
+        if (!tank.isDestroyed()) {
+            stats_.aliveTanks[tank.getPlayerId() - 1]--;
+            stats_.tanksKilled++;
         }
     }
+    obj.destroy();
 }
 
-std::vector<Shell*> GameManager::getShellPtrs() const {
-    std::vector<Shell*> result;
-    for (const auto& shell : shells_) {
-        result.push_back(shell.get());
+//a dead tank stays in p1Tanks_/p2Tanks_ for the output file, but it must leave the board.
+//called after the collision passes, so no cell is being iterated while we remove.
+//tanks killed this step are still in the alive list until compactAliveTanks.
+void GameManager::removeKilledTanksFromBoard() {
+    for (Tank* t : aliveTanks_) if (t->isDestroyed()) board_.removeObject(t, t->getPosition());
+}
+
+void GameManager::clearPhaseBuckets() {
+    battleInfoTanks_.clear();
+    shootingTanks_.clear();
+    actingTanks_.clear();
+    autoMoveBackTanks_.clear();
+    movedTanks_.clear();
+}
+
+//drop the tanks that died this step from the alive list (keeps the order: player 1 first, then player 2)
+void GameManager::compactAliveTanks() {
+    aliveTanks_.erase(std::remove_if(aliveTanks_.begin(), aliveTanks_.end(),
+                                     [](Tank* t) { return t->isDestroyed(); }),
+                      aliveTanks_.end());
+}
+
+//debug only (TANKGAME_CHECK_BOARD): the board must match the objects the game manager owns
+void GameManager::checkBoardConsistency() const {
+    std::string problem;
+    if (!board_.checkConsistency(&problem)) {
+        std::cerr << "Board check failed after step " << stepCounter_ << ": " << problem << std::endl;
+        std::abort();
+    }
+
+    auto isOnBoard = [&](GameObject* obj) {
+        for (GameObject* o : board_.getObjectsAt(obj->getPosition())) if (o == obj) return true;
+        return false;
+    };
+    std::unordered_map<int, int> shellsPerCell;
+    for (int slot = 0; slot < shells_.slotCount(); ++slot) {
+        if (!shells_.isAlive(slot)) continue;
+        Position pos = shells_.getPosition(slot);
+        shellsPerCell[pos.getY() * boardWidth_ + pos.getX()]++;
+    }
+    for (const auto& [cell, count] : shellsPerCell) {
+        if (board_.getShellCount({cell % boardWidth_, cell / boardWidth_}) != count) {
+            std::cerr << "Board check failed after step " << stepCounter_ << ": shell count out of sync" << std::endl;
+            std::abort();
+        }
+    }
+    for (Tank* t : allTanksSorted_) {
+        if (isOnBoard(t) == t->isDestroyed()) {
+            std::cerr << "Board check failed after step " << stepCounter_ << ": tank " << t->getId()
+                      << (t->isDestroyed() ? " is dead but still on the board" : " missing from the board") << std::endl;
+            std::abort();
+        }
+    }
+
+    //the incremental counters must match a full scan
+    GameStats scanned;
+    for (Tank* t : aliveTanks_) scanned.aliveTanks[t->getPlayerId() - 1]++;
+    for (const auto& t : p1Tanks_) scanned.shellsLeft += t->getShellsLeft();
+    for (const auto& t : p2Tanks_) scanned.shellsLeft += t->getShellsLeft();
+    if (scanned.aliveTanks[0] != stats_.aliveTanks[0] || scanned.aliveTanks[1] != stats_.aliveTanks[1] ||
+        scanned.shellsLeft != stats_.shellsLeft) {
+        std::cerr << "Board check failed after step " << stepCounter_ << ": game stats out of sync" << std::endl;
+        std::abort();
+    }
+
+    //the incremental raster must draw what a full capture draws
+    auto drawn = raster_->snapshot();
+    auto captured = BattlefieldSnapshot::capture(board_);
+    for (int y = 0; y < boardHeight_; ++y) {
+        if (!std::equal(drawn->getRow(y), drawn->getRow(y) + boardWidth_, captured->getRow(y))) {
+            std::cerr << "Board check failed after step " << stepCounter_ << ": satellite raster out of sync in row "
+                      << y << std::endl;
+            std::abort();
+        }
+    }
+    for (int list = 0; list < BattlefieldSnapshot::SYMBOL_LIST_COUNT; ++list) {
+        auto kind = static_cast<BattlefieldSnapshot::SymbolList>(list);
+        if (drawn->getPositions(kind) != captured->getPositions(kind)) {
+            std::cerr << "Board check failed after step " << stepCounter_ << ": satellite symbol list " << list
+                      << " out of sync" << std::endl;
+            std::abort();
+        }
     }
-    return result;
 }
 
 std::vector<Mine*> GameManager::getMinePtrs() const {
@@ -355,22 +485,27 @@ void GameManager::handleMoveTankForward(Tank& tank) {
 
     //check if there is wall in the new position.
     //if there is, print bad step (=ignored) and do not move the tank, aka do not change the tank's position
-    const auto& objects = board_.getObjectsAt(newPos);
-    for (const auto& obj : objects)
-    {
-        if (dynamic_cast<Wall*>(obj)) {
-            tank.setPosition(oldPos);
-            tank.setWasLastActionIgnored(true);
-            return;
-        }
+    if (board_.isWall(newPos)) {
+        tank.setPosition(oldPos);
+        tank.setWasLastActionIgnored(true);
+        return;
     }
 
     //if there is no wall
-    tank.setPosition(newPos);
+    moveTankOnBoard(tank, oldPos, newPos);
     tank.setWasLastActionIgnored(false);
     tank.setLastAction(ActionRequest::MoveForward);
 }
 
+//the tank is already at newPos (maybe not wrapped yet); move it on the board too,
+//and remember it for the collision phase
+void GameManager::moveTankOnBoard(Tank& tank, Position oldPos, Position newPos) {
+    tank.setPosition(newPos);
+    if (newPos == oldPos) return; //e.g. moving forward only canceled a move back
+    board_.moveObject(&tank, oldPos, newPos);
+    movedTanks_.push_back(&tank);
+}
+
 void GameManager::handleMoveTankBack(Tank& tank) {
     Position oldPos = tank.getPosition();
 
@@ -388,17 +523,14 @@ void GameManager::handleMoveTankBack(Tank& tank) {
 
         //check if there is wall in the new position.
         //if there is, print bad step (=ignored) and do not move the tank, aka do not change the tank's position
-        const auto& objects = board_.getObjectsAt(newPos);
-        for (const auto& obj : objects)
-        {
-            if (dynamic_cast<Wall*>(obj)) {
-                tank.setPosition(oldPos);
-                tank.setWasLastActionIgnored(true);
-                return;
-            }
+        if (board_.isWall(newPos)) {
+            tank.setPosition(oldPos);
+            tank.setWasLastActionIgnored(true);
+            return;
         }
 
         //if there is no wall
+        moveTankOnBoard(tank, oldPos, newPos);
         tank.setWasLastActionIgnored(false);
         tank.setLastAction(ActionRequest::MoveBackward);
     }
@@ -415,14 +547,11 @@ void GameManager::handleMoveTankBack(Tank& tank) {
 
        //check if there is wall in the new position.
        //if there is, print bad step (=ignored) and do not move the tank, aka do not change the tank's position
-       const auto& objects = board_.getObjectsAt(newPos);
-       for (const auto& obj : objects)
-       {
-         if (dynamic_cast<Wall*>(obj)) {
-            tank.setPosition(oldPos);
-            return;
-         }
+       if (board_.isWall(newPos)) {
+          tank.setPosition(oldPos);
+          return;
        }
+       moveTankOnBoard(tank, oldPos, newPos);
     }
 }
 
@@ -503,7 +632,6 @@ void GameManager::printGoodStep(Tank& tank, ActionRequest action) {
 }
 
 
-template void GameManager::cleanupDestroyedObjects<Shell>(std::vector<std::unique_ptr<Shell>>&);
 template void GameManager::cleanupDestroyedObjects<Wall>(std::vector<std::unique_ptr<Wall>>&);
 template void GameManager::cleanupDestroyedObjects<Tank>(std::vector<std::unique_ptr<Tank>>&);
 template void GameManager::cleanupDestroyedObjects<Mine>(std::vector<std::unique_ptr<Mine>>&);
@@ -577,13 +705,11 @@ void GameManager::printGameResult(int p1Alive, int p2Alive)
 //returns true if a player, or both, lost all of his tanks.
 //else, returns false
 //also count the tanks, on the way
-bool GameManager::checkIfPlayerLostAllTanks(int& p1Alive, int& p2Alive)
+bool GameManager::checkIfPlayerLostAllTanks(int& p1Alive, int& p2Alive) const
 {
-    p1Alive = std::count_if(p1Tanks_.begin(), p1Tanks_.end(),
-                                [](const std::unique_ptr<Tank>& t) { return !t->isDestroyed(); });
-
-    p2Alive = std::count_if(p2Tanks_.begin(), p2Tanks_.end(),
-                                [](const std::unique_ptr<Tank>& t) { return !t->isDestroyed(); });
+    //the counters are updated when a tank dies (destroyObject)
+    p1Alive = stats_.getAliveTanks(1);
+    p2Alive = stats_.getAliveTanks(2);
 
     if (p1Alive == 0 || p2Alive == 0) {
        return true;
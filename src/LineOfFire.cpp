@@ -0,0 +1,68 @@
+#include "../include/LineOfFire.h"
+#include <algorithm>
+
+void LineOfFire::build(const Topology& topology, const uint8_t* walls) {
+    topology_ = topology;
+    const int cells = topology_.getCellCount();
+    clear_.assign(static_cast<size_t>(cells) * DIRECTION_COUNT, NO_WALL);
+    seen_.resize(cells);
+
+    // every ray is a cycle on the torus: collect each one once, then fill it in going
+    // backwards from one of its walls (the cell before a wall has 0 clear cells)
+    for (int d = 0; d < DIRECTION_COUNT; ++d) {
+        Direction dir = static_cast<Direction>(d);
+        std::fill(seen_.begin(), seen_.end(), 0);
+        for (int start = 0; start < cells; ++start) {
+            if (seen_[start]) continue;
+            ray_.clear();
+            int wallAt = -1;
+            Position pos = topology_.positionOf(start);
+            int cell = start;
+            do {
+                if (walls[cell]) wallAt = static_cast<int>(ray_.size());
+                ray_.push_back(cell);
+                seen_[cell] = 1;
+                pos = topology_.step(pos, dir);
+                cell = topology_.indexOf(pos);
+            } while (cell != start);
+            if (wallAt < 0) continue;  // stays NO_WALL
+
+            const int length = static_cast<int>(ray_.size());
+            int32_t run = 0;  // clear cells after the one we are at
+            for (int i = 1; i <= length; ++i) {
+                int at = wallAt - i;
+                if (at < 0) at += length;
+                clear_[stateOf(ray_[at], dir)] = run;
+                run = walls[ray_[at]] ? 0 : run + 1;
+            }
+        }
+    }
+}
+
+void LineOfFire::wallChanged(const uint8_t* walls, int cell) {
+    const Position at = topology_.positionOf(cell);
+    const bool isWall = walls[cell] != 0;
+
+    // only the cells behind `at`, back to the previous wall, see it first
+    for (int d = 0; d < DIRECTION_COUNT; ++d) {
+        Direction dir = static_cast<Direction>(d);
+        Direction back = rotateDirection(dir, DIRECTION_COUNT / 2);
+        // with the wall gone, the cells behind see what `at` sees - unless it was the only
+        // wall on the ray, which then meets no wall at all
+        int32_t beyond = clear_[stateOf(cell, dir)];
+        if (!isWall && beyond + 1 == topology_.rayLength(dir)) beyond = NO_WALL;
+
+        Position pos = at;
+        for (int32_t k = 1;; ++k) {
+            pos = topology_.step(pos, back);
+            int behind = topology_.indexOf(pos);
+            clear_[stateOf(behind, dir)] = isWall ? k - 1 : beyond == NO_WALL ? NO_WALL : beyond + k;
+            if (behind == cell || walls[behind]) break;
+        }
+    }
+}
+
+bool LineOfFire::canHit(Position from, Direction d, Position target) const {
+    int steps = topology_.stepsAlong(from, d, target);
+    return steps > 0 && steps <= clearCells(from, d);
+}
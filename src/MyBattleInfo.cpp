@@ -1,23 +1,36 @@
 #include "../include/MyBattleInfo.h"
+#include "../include/SatelliteViewImpl.h"
 
-MyBattleInfo::MyBattleInfo(const SatelliteView& view, int playerIndex, size_t rows,
-                           size_t cols, std::pair<size_t, size_t> selfPos)
-        : battlefield_(rows, std::vector<char>(cols, ' ')),
-          rows_(rows), cols_(cols),
-          playerIndex_(playerIndex),
-          selfPos_(selfPos) {
+MyBattleInfo::MyBattleInfo(const SatelliteView& view, int playerIndex, size_t rows, size_t cols)
+        : playerIndex_(playerIndex), selfPos_(0, 0) {
+    if (auto* ours = dynamic_cast<const SatelliteViewImpl*>(&view)) {
+        snapshot_ = ours->getSnapshot();
+        selfRow_ = ours->getSelfRow();
+        delta_ = ours->getDelta();
+        selfPos_ = ours->getSelfPosition();
+        return;
+    }
 
-    for (size_t y = 0; y < rows; ++y) {
-        for (size_t x = 0; x < cols; ++x) {
-            char obj = view.getObjectAt(x, y);
-            battlefield_[y][x] = (x == selfPos.first && y == selfPos.second) ? '%' : obj;
+    std::vector<char> cells(rows * cols);
+    auto* bulk = dynamic_cast<const BulkSatelliteView*>(&view);
+    if (bulk && bulk->getWidth() == cols && bulk->getHeight() == rows) {
+        bulk->copyRegion(0, 0, cols, rows, cells.data());
+    } else {
+        for (size_t y = 0; y < rows; ++y) {
+            for (size_t x = 0; x < cols; ++x) cells[y * cols + x] = view.getObjectAt(x, y);
         }
     }
+    for (size_t i = 0; i < cells.size(); ++i) {
+        if (cells[i] == BattlefieldSnapshot::SELF) selfPos_ = {i % cols, i / cols};
+    }
+    snapshot_ = std::make_shared<const BattlefieldSnapshot>(cols, rows, std::move(cells));
+    selfRow_ = snapshot_->copyRowWithSelf(selfPos_.first, selfPos_.second);
 }
 
-char MyBattleInfo::getObjectAt(size_t x, size_t y) const {
-    if (x >= cols_ || y >= rows_) return '&';
-    return battlefield_[y][x];
+MyBattleInfo::MyBattleInfo(std::shared_ptr<const BattlefieldSnapshot> snapshot, int playerIndex,
+                           std::pair<size_t, size_t> selfPos)
+        : snapshot_(std::move(snapshot)), playerIndex_(playerIndex), selfPos_(selfPos) {
+    selfRow_ = snapshot_->copyRowWithSelf(selfPos.first, selfPos.second);
 }
 
 Direction MyBattleInfo::inferSelfDirection() const {
@@ -34,8 +47,8 @@ Direction MyBattleInfo::inferSelfDirection() const {
     for (const auto& [dx, dy, dir] : directions) {
         int nx = x + dx;
         int ny = y + dy;
-        if (nx >= 0 && ny >= 0 && nx < static_cast<int>(cols_) && ny < static_cast<int>(rows_)) {
-            if (battlefield_[ny][nx] == '%') {
+        if (nx >= 0 && ny >= 0 && nx < static_cast<int>(getCols()) && ny < static_cast<int>(getRows())) {
+            if (getObjectAt(nx, ny) == BattlefieldSnapshot::SELF) {
                 return dir;
             }
         }
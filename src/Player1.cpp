@@ -7,7 +7,12 @@ Player1::Player1(int player_index, size_t x, size_t y, size_t max_steps, size_t
           board_height_(y) {}
 
 void Player1::updateTankWithBattleInfo(TankAlgorithm& tank, SatelliteView& satellite_view) {
-    MyBattleInfo info(satellite_view, player_index_, board_height_, board_width_, {0, 0});
+    MyBattleInfo info(satellite_view, player_index_, board_height_, board_width_);  // shares the view's snapshot
+    info.setShellThreats(shellThreats_.get(info.getSequence(), [&](ShellThreatMap& threats) {
+        threats.compute(*info.getSnapshot(), ZoneControlAlgo::THREAT_HORIZON);
+    }));
+    info.setFireMatrix(fire_.matrixFor(*info.getSnapshot()));
+    info.setLineOfFire(fire_.lineOfFireFor(*info.getSnapshot()));
     tank.updateBattleInfo(info);  // Polymorphic dispatch
 }
 
@@ -7,7 +7,11 @@ Player2::Player2(int player_index, size_t x, size_t y, size_t max_steps, size_t
           board_height_(y) {}
 
 void Player2::updateTankWithBattleInfo(TankAlgorithm& tank, SatelliteView& satellite_view) {
-    MyBattleInfo info(satellite_view, player_index_, board_height_, board_width_, {0, 0});
+    MyBattleInfo info(satellite_view, player_index_, board_height_, board_width_);  // shares the view's snapshot
+    info.setEnemyDistances(enemyDistances_.get(info.getSequence(), [&](DistanceField& field) {
+        field.compute(*info.getSnapshot(), info.getEnemies());
+    }));
+    info.setFireMatrix(fire_.matrixFor(*info.getSnapshot()));
+    info.setLineOfFire(fire_.lineOfFireFor(*info.getSnapshot()));
     tank.updateBattleInfo(info);  // Polymorphic dispatch
 }
-
@@ -0,0 +1,129 @@
+#include "../include/SatelliteRaster.h"
+#include <algorithm>
+#include <iterator>
+
+namespace {
+
+using PositionVector = std::vector<Position>;
+
+// list - removed + added, all three in row-major order
+BattlefieldSnapshot::PositionList patchList(const PositionVector& list, PositionVector& removed, PositionVector& added) {
+    std::sort(removed.begin(), removed.end(), BattlefieldSnapshot::isBefore);
+    std::sort(added.begin(), added.end(), BattlefieldSnapshot::isBefore);
+    PositionVector kept;
+    kept.reserve(list.size());
+    std::set_difference(list.begin(), list.end(), removed.begin(), removed.end(), std::back_inserter(kept),
+                        BattlefieldSnapshot::isBefore);
+    auto patched = std::make_shared<PositionVector>();
+    patched->reserve(kept.size() + added.size());
+    std::merge(kept.begin(), kept.end(), added.begin(), added.end(), std::back_inserter(*patched),
+               BattlefieldSnapshot::isBefore);
+    return patched;
+}
+
+} // namespace
+
+SatelliteRaster::SatelliteRaster(const Board& board)
+        : board_(board), width_(board.getWidth()), height_(board.getHeight()),
+          isCellDirty_(static_cast<size_t>(width_) * height_, 0),
+          isRowDirty_(height_, 0) {
+    rows_.reserve(height_);
+    for (int y = 0; y < height_; ++y) {
+        auto row = std::make_shared<std::vector<char>>(width_);
+        for (int x = 0; x < width_; ++x) (*row)[x] = BattlefieldSnapshot::symbolAt(board_, Position(x, y));
+        rows_.push_back(std::move(row));
+    }
+
+    std::array<PositionVector, BattlefieldSnapshot::SYMBOL_LIST_COUNT> lists;
+    for (int y = 0; y < height_; ++y) {
+        for (int x = 0; x < width_; ++x) {
+            int list = BattlefieldSnapshot::listOf((*rows_[y])[x]);
+            if (list >= 0) lists[list].emplace_back(x, y);
+        }
+    }
+    for (int i = 0; i < BattlefieldSnapshot::SYMBOL_LIST_COUNT; ++i) {
+        lists_[i] = std::make_shared<const PositionVector>(std::move(lists[i]));
+    }
+}
+
+void SatelliteRaster::markDirty(int index) {
+    if (isCellDirty_[index]) return;
+    isCellDirty_[index] = 1;
+    dirtyCells_.push_back(index);
+}
+
+// every kind of change can change the top symbol of the cell(s) it touches
+void SatelliteRaster::onBoardChange(const BoardChange& change) {
+    markDirty(change.index);
+    if (change.kind == BoardChangeKind::ObjectMoved || change.kind == BoardChangeKind::ShellMoved) {
+        markDirty(change.toIndex);
+    }
+}
+
+std::shared_ptr<const BattlefieldSnapshot> SatelliteRaster::snapshot() {
+    if (last_ && dirtyCells_.empty()) return last_;
+    last_.reset();  // so the rows only we hold are updated in place
+
+    JournalEntry entry{++sequence_, {}};
+    std::array<PositionVector, BattlefieldSnapshot::SYMBOL_LIST_COUNT> removed, added;
+    for (int index : dirtyCells_) {
+        int y = index / width_;
+        int x = index % width_;
+        isCellDirty_[index] = 0;
+        char symbol = BattlefieldSnapshot::symbolAt(board_, Position(x, y));
+        char oldSymbol = (*rows_[y])[x];
+        if (oldSymbol == symbol) continue;  // e.g. a shell that came and went
+
+        int oldList = BattlefieldSnapshot::listOf(oldSymbol);
+        int newList = BattlefieldSnapshot::listOf(symbol);
+        if (oldList >= 0) removed[oldList].emplace_back(x, y);
+        if (newList >= 0) added[newList].emplace_back(x, y);
+
+        if (!isRowDirty_[y]) {
+            isRowDirty_[y] = 1;
+            // copy on write: the old row may still be in snapshots someone holds
+            if (rows_[y].use_count() > 1) rows_[y] = std::make_shared<std::vector<char>>(*rows_[y]);
+        }
+        (*rows_[y])[x] = symbol;
+        entry.cells.push_back(index);
+    }
+    for (int index : entry.cells) isRowDirty_[index / width_] = 0;
+    dirtyCells_.clear();
+
+    journal_.push_back(std::move(entry));
+    if (journal_.size() > MAX_JOURNAL_SNAPSHOTS) journal_.pop_front();
+
+    // only the lists that changed are rebuilt, the others stay shared with older snapshots
+    for (int i = 0; i < BattlefieldSnapshot::SYMBOL_LIST_COUNT; ++i) {
+        if (!removed[i].empty() || !added[i].empty()) lists_[i] = patchList(*lists_[i], removed[i], added[i]);
+    }
+
+    std::vector<BattlefieldSnapshot::Row> rows(rows_.begin(), rows_.end());
+    last_ = std::make_shared<const BattlefieldSnapshot>(width_, height_, std::move(rows), lists_, sequence_);
+    return last_;
+}
+
+std::shared_ptr<const DeltaBattleInfo> SatelliteRaster::deltaSince(uint64_t baseSequence) const {
+    if (!last_ || baseSequence == 0 || baseSequence > sequence_) return nullptr;
+    // entry s holds the changes from s - 1 to s, so we need baseSequence + 1 .. sequence_
+    if (baseSequence < sequence_ && (journal_.empty() || journal_.front().sequence > baseSequence + 1)) return nullptr;
+
+    std::vector<int> cells;
+    for (auto it = journal_.rbegin(); it != journal_.rend() && it->sequence > baseSequence; ++it) {
+        cells.insert(cells.end(), it->cells.begin(), it->cells.end());
+    }
+    std::sort(cells.begin(), cells.end());
+    cells.erase(std::unique(cells.begin(), cells.end()), cells.end());
+    if (cells.size() > static_cast<size_t>(width_) * height_ / 4) return nullptr;
+
+    auto delta = std::make_shared<DeltaBattleInfo>();
+    delta->baseSequence = baseSequence;
+    delta->sequence = sequence_;
+    delta->cells.reserve(cells.size());
+    for (int index : cells) {
+        int y = index / width_;
+        int x = index % width_;
+        delta->cells.push_back({x, y, (*rows_[y])[x]});
+    }
+    return delta;
+}
@@ -1,11 +1,13 @@
 #include "../include/SatelliteViewImpl.h"
 
-SatelliteViewImpl::SatelliteViewImpl(const std::vector<std::vector<char>>& boardData)
-        : board_(boardData) {}
+SatelliteViewImpl::SatelliteViewImpl(std::shared_ptr<const BattlefieldSnapshot> snapshot,
+                                     std::pair<size_t, size_t> selfPos,
+                                     std::shared_ptr<const DeltaBattleInfo> delta)
+        : snapshot_(std::move(snapshot)), selfPos_(selfPos),
+          selfRow_(snapshot_->copyRowWithSelf(selfPos.first, selfPos.second)),
+          delta_(std::move(delta)) {}
 
 char SatelliteViewImpl::getObjectAt(size_t x, size_t y) const {
-    if (y >= board_.size() || x >= board_[y].size()) {
-        return '&'; // Out of bounds
-    }
-    return board_[y][x];
+    if (x == selfPos_.first && y == selfPos_.second) return BattlefieldSnapshot::SELF;
+    return snapshot_->getObjectAt(x, y);  // '&' out of bounds
 }
@@ -4,7 +4,7 @@
 #include "../include/MovingGameObject.h"
 
 Shell::Shell(Position pos, Direction dir, int tankId)
-    : MovingGameObject(pos, dir), tankId_(tankId) {}
+    : MovingGameObject(pos, ObjectKind::Shell, dir), tankId_(tankId) {}
 
 bool Shell::moveForward() {
     switch (dir_) {
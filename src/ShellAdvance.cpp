@@ -0,0 +1,116 @@
+#include "../include/ShellAdvance.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SHELL_ADVANCE_X86 1
+#include <immintrin.h>
+#endif
+
+namespace {
+
+// x + step, then add the size if it went below 0 and subtract it if it reached the size.
+// the compares become masks, so there is no branch (and no modulo) per shell.
+inline int32_t wrapStep(int32_t v, int32_t step, int32_t size) {
+    v += step;
+    v += size & -static_cast<int32_t>(v < 0);
+    v -= size & -static_cast<int32_t>(v >= size);
+    return v;
+}
+
+void advanceScalar(int32_t* x, int32_t* y, const int32_t* dx, const int32_t* dy,
+                   int begin, int count, int width, int height) {
+    for (int i = begin; i < count; ++i) {
+        x[i] = wrapStep(x[i], dx[i], width);
+        y[i] = wrapStep(y[i], dy[i], height);
+    }
+}
+
+#ifdef SHELL_ADVANCE_X86
+
+__attribute__((target("sse2")))
+inline __m128i wrapStep128(__m128i v, __m128i step, __m128i size, __m128i sizeMinusOne) {
+    v = _mm_add_epi32(v, step);
+    v = _mm_add_epi32(v, _mm_and_si128(_mm_cmplt_epi32(v, _mm_setzero_si128()), size));
+    v = _mm_sub_epi32(v, _mm_and_si128(_mm_cmpgt_epi32(v, sizeMinusOne), size));
+    return v;
+}
+
+__attribute__((target("sse2")))
+void advanceSSE2(int32_t* x, int32_t* y, const int32_t* dx, const int32_t* dy,
+                 int count, int width, int height) {
+    const __m128i w = _mm_set1_epi32(width), wLast = _mm_set1_epi32(width - 1);
+    const __m128i h = _mm_set1_epi32(height), hLast = _mm_set1_epi32(height - 1);
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i vx = _mm_loadu_si128(reinterpret_cast<const __m128i*>(x + i));
+        __m128i vy = _mm_loadu_si128(reinterpret_cast<const __m128i*>(y + i));
+        __m128i sx = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dx + i));
+        __m128i sy = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dy + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(x + i), wrapStep128(vx, sx, w, wLast));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(y + i), wrapStep128(vy, sy, h, hLast));
+    }
+    advanceScalar(x, y, dx, dy, i, count, width, height);
+}
+
+__attribute__((target("avx2")))
+inline __m256i wrapStep256(__m256i v, __m256i step, __m256i size, __m256i sizeMinusOne) {
+    v = _mm256_add_epi32(v, step);
+    v = _mm256_add_epi32(v, _mm256_and_si256(_mm256_cmpgt_epi32(_mm256_setzero_si256(), v), size));
+    v = _mm256_sub_epi32(v, _mm256_and_si256(_mm256_cmpgt_epi32(v, sizeMinusOne), size));
+    return v;
+}
+
+__attribute__((target("avx2")))
+void advanceAVX2(int32_t* x, int32_t* y, const int32_t* dx, const int32_t* dy,
+                 int count, int width, int height) {
+    const __m256i w = _mm256_set1_epi32(width), wLast = _mm256_set1_epi32(width - 1);
+    const __m256i h = _mm256_set1_epi32(height), hLast = _mm256_set1_epi32(height - 1);
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i vx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + i));
+        __m256i vy = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(y + i));
+        __m256i sx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dx + i));
+        __m256i sy = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dy + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(x + i), wrapStep256(vx, sx, w, wLast));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(y + i), wrapStep256(vy, sy, h, hLast));
+    }
+    advanceScalar(x, y, dx, dy, i, count, width, height);
+}
+
+#endif // SHELL_ADVANCE_X86
+
+} // namespace
+
+namespace ShellAdvance {
+
+    Kernel bestKernel() {
+#ifdef SHELL_ADVANCE_X86
+        static const Kernel best = __builtin_cpu_supports("avx2") ? Kernel::AVX2
+                                 : __builtin_cpu_supports("sse2") ? Kernel::SSE2
+                                 : Kernel::Scalar;
+        return best;
+#else
+        return Kernel::Scalar;
+#endif
+    }
+
+    bool isSupported(Kernel kernel) {
+        return static_cast<int>(kernel) <= static_cast<int>(bestKernel());
+    }
+
+    const char* kernelName(Kernel kernel) {
+        switch (kernel) {
+        case Kernel::AVX2: return "avx2";
+        case Kernel::SSE2: return "sse2";
+        default:           return "scalar";
+        }
+    }
+
+    void advance(int32_t* x, int32_t* y, const int32_t* dx, const int32_t* dy, int count,
+                 int width, int height, Kernel kernel) {
+#ifdef SHELL_ADVANCE_X86
+        if (kernel == Kernel::AVX2) { advanceAVX2(x, y, dx, dy, count, width, height); return; }
+        if (kernel == Kernel::SSE2) { advanceSSE2(x, y, dx, dy, count, width, height); return; }
+#endif
+        advanceScalar(x, y, dx, dy, 0, count, width, height);
+    }
+}
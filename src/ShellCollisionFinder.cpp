@@ -0,0 +1,63 @@
+#include "../include/ShellCollisionFinder.h"
+#include <cstddef>
+
+// BUCKET ALL LIVE SHELLS BY KEY
+
+template<typename KeyOf>
+const std::vector<int>& ShellCollisionFinder::findCollisions(const ShellPool& shells, KeyOf keyOf) {
+    hits_.clear();
+    if (shells.getLiveCount() < 2) return hits_;
+
+    // power of two, at least twice the shells, so probing stays short
+    size_t capacity = 16;
+    while (capacity < static_cast<size_t>(shells.getLiveCount()) * 2) capacity *= 2;
+    table_.assign(capacity, Bucket{EMPTY_KEY, -1, false});
+    const size_t mask = capacity - 1;
+
+    for (int slot = 0; slot < shells.slotCount(); ++slot) {
+        if (!shells.isAlive(slot)) continue;
+        int64_t key = keyOf(slot);
+
+        size_t i = static_cast<size_t>((static_cast<uint64_t>(key) * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+        while (table_[i].key != EMPTY_KEY && table_[i].key != key) i = (i + 1) & mask;
+
+        Bucket& bucket = table_[i];
+        if (bucket.key == EMPTY_KEY) {
+            bucket = Bucket{key, slot, false};
+            continue;
+        }
+        if (!bucket.collided) {
+            bucket.collided = true;
+            hits_.push_back(bucket.firstSlot);
+        }
+        hits_.push_back(slot);
+    }
+    return hits_;
+}
+
+// CROSSING MOVES (before the move)
+
+const std::vector<int>& ShellCollisionFinder::findCrossings(const ShellPool& shells, int boardWidth, int boardHeight) {
+    const int64_t doubledWidth = 2LL * boardWidth;
+    const int64_t doubledHeight = 2LL * boardHeight;
+
+    return findCollisions(shells, [&](int slot) {
+        Position pos = shells.getPosition(slot);
+        int d = static_cast<int>(shells.getDirection(slot));
+        // midpoint of the move, in doubled coordinates, wrapped (only -1 can fall outside)
+        int64_t mx = 2LL * pos.getX() + DIRECTION_DX[d];
+        int64_t my = 2LL * pos.getY() + DIRECTION_DY[d];
+        if (mx < 0) mx += doubledWidth;
+        if (my < 0) my += doubledHeight;
+        return my * doubledWidth + mx;
+    });
+}
+
+// SAME CELL (after the move)
+
+const std::vector<int>& ShellCollisionFinder::findSharedCells(const ShellPool& shells, int boardWidth) {
+    return findCollisions(shells, [&](int slot) {
+        Position pos = shells.getPosition(slot);
+        return static_cast<int64_t>(pos.getY()) * boardWidth + pos.getX();
+    });
+}
@@ -0,0 +1,88 @@
+#include "../include/ShellPool.h"
+#include "../include/ShellAdvance.h"
+
+// SPAWN
+
+int ShellPool::spawn(Position pos, Direction dir, int ownerTankId) {
+    int d = static_cast<int>(dir);
+    int slot;
+    if (!freeSlots_.empty()) {
+        slot = freeSlots_.back();
+        freeSlots_.pop_back();
+    } else {
+        slot = slotCount();
+        x_.push_back(0); y_.push_back(0);
+        dx_.push_back(0); dy_.push_back(0);
+        dir_.push_back(0);
+        owner_.push_back(0);
+        state_.push_back(SLOT_FREE);
+    }
+
+    x_[slot] = pos.getX();
+    y_[slot] = pos.getY();
+    dx_[slot] = DIRECTION_DX[d];
+    dy_[slot] = DIRECTION_DY[d];
+    dir_[slot] = static_cast<uint8_t>(d);
+    owner_[slot] = ownerTankId;
+    state_[slot] = SLOT_ALIVE;
+    liveCount_++;
+    return slot;
+}
+
+// DESTROY (the slot is freed later, by releaseDestroyed)
+
+void ShellPool::destroy(int slot) {
+    if (state_[slot] != SLOT_ALIVE) return;
+    state_[slot] = SLOT_DESTROYED;
+    liveCount_--;
+    destroyedCount_++;
+}
+
+// MOVE
+
+void ShellPool::advance(int slot, int boardWidth, int boardHeight) {
+    int x = x_[slot] + dx_[slot];
+    int y = y_[slot] + dy_[slot];
+    // a shell moves a single cell, so one compare per edge is enough to wrap
+    if (x < 0) x += boardWidth; else if (x >= boardWidth) x -= boardWidth;
+    if (y < 0) y += boardHeight; else if (y >= boardHeight) y -= boardHeight;
+    x_[slot] = x;
+    y_[slot] = y;
+}
+
+void ShellPool::advanceAll(int boardWidth, int boardHeight) {
+    if (destroyedCount_ > 0) {
+        // a destroyed shell must stay where it died until it is taken off the board
+        for (int slot = 0; slot < slotCount(); ++slot) {
+            if (isAlive(slot)) advance(slot, boardWidth, boardHeight);
+        }
+        return;
+    }
+    ShellAdvance::advance(x_.data(), y_.data(), dx_.data(), dy_.data(), slotCount(), boardWidth, boardHeight);
+}
+
+// COMPACT
+
+void ShellPool::compact() {
+    int write = 0;
+    for (int read = 0; read < slotCount(); ++read) {
+        if (state_[read] == SLOT_FREE) continue;
+        if (write != read) {
+            x_[write] = x_[read];
+            y_[write] = y_[read];
+            dx_[write] = dx_[read];
+            dy_[write] = dy_[read];
+            dir_[write] = dir_[read];
+            owner_[write] = owner_[read];
+            state_[write] = state_[read];
+        }
+        write++;
+    }
+
+    x_.resize(write); y_.resize(write);
+    dx_.resize(write); dy_.resize(write);
+    dir_.resize(write);
+    owner_.resize(write);
+    state_.resize(write);
+    freeSlots_.clear();
+}
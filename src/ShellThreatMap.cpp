@@ -0,0 +1,37 @@
+#include "../include/ShellThreatMap.h"
+#include <algorithm>
+
+void ShellThreatMap::compute(const BattlefieldSnapshot& snapshot, int horizon) {
+    topology_ = Topology(static_cast<int>(snapshot.getWidth()), static_cast<int>(snapshot.getHeight()));
+    horizon_ = std::min(std::max(horizon, 0), MAX_HORIZON);
+    sequence_ = snapshot.getSequence();
+
+    const size_t cells = static_cast<size_t>(topology_.getCellCount());
+    if (marks_.size() != cells) {
+        marks_.assign(cells, 0);
+        generation_ = 0;
+    }
+    if (++generation_ > MAX_GENERATION) {
+        // the stamps went all the way around - forget them once, start again from 1
+        std::fill(marks_.begin(), marks_.end(), 0);
+        generation_ = 1;
+    }
+
+    // a mark of an earlier computation is below base, so mark - base wraps to a huge number:
+    // one unsigned compare tells "not marked yet, or marked for a later step"
+    const uint32_t base = generation_ << STEP_BITS;
+    const int moves = horizon_ * Shell::MOVES_PER_STEP;
+    for (const Position& shell : snapshot.getPositions(BattlefieldSnapshot::SHELLS)) {
+        for (int d = 0; d < DIRECTION_COUNT; ++d) {
+            int x = shell.getX(), y = shell.getY();
+            for (int move = 0; move < moves; ++move) {
+                x = topology_.wrapX(x + DIRECTION_DX[d]);
+                y = topology_.wrapY(y + DIRECTION_DY[d]);
+                if (snapshot.getRow(y)[x] == '#') break;  // the shell ends in the wall
+                uint32_t step = static_cast<uint32_t>(move / Shell::MOVES_PER_STEP + 1);
+                uint32_t& mark = marks_[y * topology_.getWidth() + x];
+                if (mark - base > step) mark = base | step;
+            }
+        }
+    }
+}
@@ -12,7 +12,18 @@
 
 
 Tank::Tank(Position pos, Direction dir, int playerId, int id)
-    : MovingGameObject(pos, dir), playerId_(playerId), id_(id) {}
+    : MovingGameObject(pos, ObjectKind::Tank, dir), playerId_(playerId), id_(id),
+      ownStore_(std::make_unique<TankStore>()), store_(ownStore_.get()) {
+    slot_ = store_->add(SHELLS_NUMBER);
+}
+
+void Tank::attachToStore(TankStore& store) {
+    int slot = store.add(SHELLS_NUMBER);
+    store.copySlot(*store_, slot_, slot);
+    store_ = &store;
+    slot_ = slot;
+    ownStore_.reset();
+}
 
 
 // MOVE FORWARD
@@ -21,8 +32,8 @@ Tank::Tank(Position pos, Direction dir, int playerId, int id)
 // if no physical movement occurs (e.g., canceling a backward wait)
 bool Tank::moveForward() {
 
-    if (isWaitingToMoveBack_) {
-        isWaitingToMoveBack_ = false;  // Cancel the backward waiting
+    if (hasFlag(TankStore::WAITING_TO_MOVE_BACK)) {
+        setFlag(TankStore::WAITING_TO_MOVE_BACK, false);  // Cancel the backward waiting
         return true;  // Action succeeded: canceled waiting
     }
 
@@ -59,15 +70,15 @@ bool Tank::moveForward() {
 // moveBack() returns true if the action succeeds in changing state (e.g., entering to a backward wait state)
 // no physical movement occurs.
 // return false if did not succeed, cuz the tank is already in waiting state.
-// make sure game manager call this function only if isRightAfterMoveBack_ == false. If it's true, the tank can move
+// make sure game manager call this function only if isRightAfterMoveBack() == false. If it's true, the tank can move
 // back immediately, no need to ask.
 bool Tank::askToMoveBack() {
 
     // NOT in waiting state → start waiting
-    if (!isWaitingToMoveBack_)
+    if (!hasFlag(TankStore::WAITING_TO_MOVE_BACK))
     {
-        isWaitingToMoveBack_ = true;
-        waitToMoveBackCounter_ = MOVE_BACK_WAIT_TURNS;
+        setFlag(TankStore::WAITING_TO_MOVE_BACK, true);
+        store_->setWaitToMoveBackCounter(slot_, MOVE_BACK_WAIT_TURNS);
         return true; // Action succeeded: entered waiting state
     }
 
@@ -84,7 +95,7 @@ bool Tank::moveBack()
 
     // extra check (cuz the game manager should check it)
     // those are the only 2 situations the tank can move back
-    if ( (isRightAfterMoveBack_) || ( (isWaitingToMoveBack_ == true) && (waitToMoveBackCounter_ == 0) ))
+    if ( (hasFlag(TankStore::RIGHT_AFTER_MOVE_BACK)) || ( hasFlag(TankStore::WAITING_TO_MOVE_BACK) && (getWaitToMoveBackCounter() == 0) ))
     {
         switch (dir_) {
             case Direction::Up:
@@ -111,8 +122,8 @@ bool Tank::moveBack()
                 return false;  // Unknown direction — fails safely. Should not happen tho.
             }
 
-        isRightAfterMoveBack_ = true;
-        isWaitingToMoveBack_= false;
+        setFlag(TankStore::RIGHT_AFTER_MOVE_BACK, true);
+        setFlag(TankStore::WAITING_TO_MOVE_BACK, false);
         return true;
 
     }
@@ -126,52 +137,53 @@ bool Tank::moveBack()
 // For game manager use only (important, to avoid double decreasing)
 void Tank::updateWaitToMoveBackCounter()
 {
-    if (isWaitingToMoveBack_ && waitToMoveBackCounter_ > 0) {
-        waitToMoveBackCounter_--;
+    int counter = getWaitToMoveBackCounter();
+    if (hasFlag(TankStore::WAITING_TO_MOVE_BACK) && counter > 0) {
+        store_->setWaitToMoveBackCounter(slot_, counter - 1);
     }
 }
 
 //For game manager use; reset after each action which is not a move back, including a failed action
 void Tank::resetIsRightAfterMoveBack()
 {
-    isRightAfterMoveBack_ = false;
+    setFlag(TankStore::RIGHT_AFTER_MOVE_BACK, false);
 }
 
 //exit the state of waiting to move back
 //for game manager use
 void Tank::resetIsWaitingToMoveBack()
 {
-    if (isWaitingToMoveBack_ &&  waitToMoveBackCounter_== 0)
+    if (hasFlag(TankStore::WAITING_TO_MOVE_BACK) && getWaitToMoveBackCounter() == 0)
     {
-        isWaitingToMoveBack_ = false;
+        setFlag(TankStore::WAITING_TO_MOVE_BACK, false);
     }
 }
 
 
 int Tank::getWaitToMoveBackCounter() const
 {
-    return waitToMoveBackCounter_;
+    return store_->getWaitToMoveBackCounter(slot_);
 }
 
 // CHANGE DIRECTION
 
 // utility functions, for tank use only
 void Tank::actualRotateEighthLeft() {
-    dir_ = static_cast<Direction>((static_cast<int>(dir_) + 7) % 8);
+    dir_ = rotateDirection(dir_, -1);
 }
 
 void Tank::actualRotateEighthRight() {
-    dir_ = static_cast<Direction>((static_cast<int>(dir_) + 1) % 8);
+    dir_ = rotateDirection(dir_, 1);
 }
 
 
 // for game manager use
 // return false if action did not succeed, cuz tank is waiting to move back,
-// including when it's the turn it should stop waiting and move back (i.e waitToMoveBackCounter_ ==0)
+// including when it's the turn it should stop waiting and move back (i.e getWaitToMoveBackCounter() ==0)
 // else, it succeeds and return true
 bool Tank::rotateEighthLeft()
 {
-    if (isWaitingToMoveBack_)
+    if (hasFlag(TankStore::WAITING_TO_MOVE_BACK))
     {
         return false;
     }
@@ -181,7 +193,7 @@ bool Tank::rotateEighthLeft()
 
 bool Tank::rotateFourthLeft()
 {
-    if (isWaitingToMoveBack_)
+    if (hasFlag(TankStore::WAITING_TO_MOVE_BACK))
     {
         return false;
     }
@@ -193,7 +205,7 @@ bool Tank::rotateFourthLeft()
 
 bool Tank::rotateEighthRight()
 {
-    if (isWaitingToMoveBack_)
+    if (hasFlag(TankStore::WAITING_TO_MOVE_BACK))
     {
         return false;
     }
@@ -203,7 +215,7 @@ bool Tank::rotateEighthRight()
 
 bool Tank::rotateFourthRight()
 {
-    if (isWaitingToMoveBack_)
+    if (hasFlag(TankStore::WAITING_TO_MOVE_BACK))
     {
         return false;
     }
@@ -216,26 +228,26 @@ bool Tank::rotateFourthRight()
 // SHOOT
 bool Tank::shoot()
 {
-    if (isWaitingToMoveBack_)
+    if (hasFlag(TankStore::WAITING_TO_MOVE_BACK))
     {
         return false;
     }
 
-    if (isWaitingAfterShoot_ && waitAfterShootCounter_ > 0)
+    if (hasFlag(TankStore::WAITING_AFTER_SHOOT) && store_->getWaitAfterShootCounter(slot_) > 0)
     {
         return false;
     }
 
-    if (shellsLeft_ <= 0)
+    if (getShellsLeft() <= 0)
     {
         return false;
     }
 
-    //if the tank is not waiting after shoot, or waiting and waitAfterShootCounter_ == 0
+    //if the tank is not waiting after shoot, or waiting and waitAfterShootCounter == 0
     //shoot
-    shellsLeft_--;
-    isWaitingAfterShoot_ = true;
-    waitAfterShootCounter_ = AFTER_SHOOT_WAIT_TURNS;
+    store_->setShellsLeft(slot_, getShellsLeft() - 1);
+    setFlag(TankStore::WAITING_AFTER_SHOOT, true);
+    store_->setWaitAfterShootCounter(slot_, AFTER_SHOOT_WAIT_TURNS);
     return true;
 }
 
@@ -246,9 +258,10 @@ bool Tank::shoot()
 // For game manager use only (important, to avoid double decreasing)
 void Tank::updateWaitAfterShootCounter()
 {
-    if (isWaitingAfterShoot_ && waitAfterShootCounter_ > 0)
+    int counter = store_->getWaitAfterShootCounter(slot_);
+    if (hasFlag(TankStore::WAITING_AFTER_SHOOT) && counter > 0)
     {
-        waitAfterShootCounter_--;
+        store_->setWaitAfterShootCounter(slot_, counter - 1);
     }
 }
 
@@ -256,9 +269,9 @@ void Tank::updateWaitAfterShootCounter()
 // for game manager use
 void Tank::resetIsWaitingAfterShoot()
 {
-    if (isWaitingAfterShoot_ &&  waitAfterShootCounter_== 0)
+    if (hasFlag(TankStore::WAITING_AFTER_SHOOT) && store_->getWaitAfterShootCounter(slot_) == 0)
     {
-        isWaitingAfterShoot_ = false;
+        setFlag(TankStore::WAITING_AFTER_SHOOT, false);
     }
 }
 
@@ -292,21 +305,21 @@ int Tank::getId() const
 
 int Tank::getShellsLeft() const
 {
-    return shellsLeft_;
+    return store_->getShellsLeft(slot_);
 }
 bool Tank::getIsWaitingToMoveBack() const
 {
-    return isWaitingToMoveBack_;
+    return hasFlag(TankStore::WAITING_TO_MOVE_BACK);
 }
 
 bool Tank::getIsWaitingAfterShoot() const
 {
-    return isWaitingAfterShoot_;
+    return hasFlag(TankStore::WAITING_AFTER_SHOOT);
 }
 
 bool Tank::getIsRightAfterMoveBack() const
 {
-    return isRightAfterMoveBack_;
+    return hasFlag(TankStore::RIGHT_AFTER_MOVE_BACK);
 }
 
 ActionRequest Tank::getNextAction() const
@@ -0,0 +1,42 @@
+#include "../include/TankStore.h"
+
+int TankStore::add(int shellsLeft) {
+    flags_.push_back(0);
+    waitAfterShoot_.push_back(0);
+    waitToMoveBack_.push_back(0);
+    shellsLeft_.push_back(shellsLeft);
+    return size() - 1;
+}
+
+void TankStore::copySlot(const TankStore& from, int fromSlot, int toSlot) {
+    flags_[toSlot] = from.flags_[fromSlot];
+    waitAfterShoot_[toSlot] = from.waitAfterShoot_[fromSlot];
+    waitToMoveBack_[toSlot] = from.waitToMoveBack_[fromSlot];
+    shellsLeft_[toSlot] = from.shellsLeft_[fromSlot];
+}
+
+// a plain loop over bytes with no early exits: the conditions are selects, which the
+// compiler turns into vector compares and masks
+void TankStore::updateCounters() {
+    uint8_t* flags = flags_.data();
+    uint8_t* shoot = waitAfterShoot_.data();
+    uint8_t* back = waitToMoveBack_.data();
+    const int n = size();
+
+    for (int i = 0; i < n; ++i) {
+        uint8_t f = flags[i];
+
+        // decrease a counter only if the tank is waiting + counter > 0
+        uint8_t b = back[i];
+        uint8_t s = shoot[i];
+        b = static_cast<uint8_t>(b - ((f & WAITING_TO_MOVE_BACK) && b > 0 ? 1 : 0));
+        s = static_cast<uint8_t>(s - ((f & WAITING_AFTER_SHOOT) && s > 0 ? 1 : 0));
+
+        // stop waiting once the counter is 0 (clearing a flag that is not set changes nothing)
+        uint8_t clearBack = b == 0 ? WAITING_TO_MOVE_BACK : 0;
+        uint8_t clearShoot = s == 0 ? WAITING_AFTER_SHOOT : 0;
+        flags[i] = static_cast<uint8_t>(f & ~(clearBack | clearShoot));
+        back[i] = b;
+        shoot[i] = s;
+    }
+}
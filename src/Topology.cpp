@@ -0,0 +1,67 @@
+#include "../include/Topology.h"
+#include <cstdint>
+
+namespace {
+    // a * x == 1 (mod m), for a and m coprime
+    int64_t inverseMod(int64_t a, int64_t m) {
+        int64_t r0 = m, r1 = a % m, s0 = 0, s1 = 1;
+        while (r1 != 0) {
+            int64_t q = r0 / r1;
+            int64_t r = r0 - q * r1; r0 = r1; r1 = r;
+            int64_t s = s0 - q * s1; s0 = s1; s1 = s;
+        }
+        return ((s0 % m) + m) % m;
+    }
+
+    int64_t gcd(int64_t a, int64_t b) {
+        while (b != 0) {
+            int64_t r = a % b;
+            a = b;
+            b = r;
+        }
+        return a;
+    }
+}
+
+int Topology::stepsAlong(Position from, Direction d, Position to) const {
+    int dx = DIRECTION_DX[static_cast<int>(d)], dy = DIRECTION_DY[static_cast<int>(d)];
+    // per axis: the steps it takes mod the axis size, or the axis has to match already
+    if (dx == 0 && from.getX() != to.getX()) return -1;
+    if (dy == 0 && from.getY() != to.getY()) return -1;
+    int a = dx > 0 ? forwardX(from.getX(), to.getX()) : forwardX(to.getX(), from.getX());
+    int b = dy > 0 ? forwardY(from.getY(), to.getY()) : forwardY(to.getY(), from.getY());
+    if (dy == 0) return a;
+    if (dx == 0) return b;
+
+    // both: k == a (mod width) and k == b (mod height), the smallest such k (chinese remainder).
+    // a == b is the usual case (always, on a square board, when it gets there at all)
+    if (a == b) return a;
+    int64_t g = gcd(width_, height_);
+    if ((b - a) % g != 0) return -1;
+    int64_t m = height_ / g;
+    int64_t t = (((b - a) / g) % m + m) % m * inverseMod(width_ / g, m) % m;
+    return static_cast<int>(a + width_ * t);
+}
+
+int Topology::rayLength(Direction d) const {
+    int dx = DIRECTION_DX[static_cast<int>(d)], dy = DIRECTION_DY[static_cast<int>(d)];
+    if (dy == 0) return width_;
+    if (dx == 0) return height_;
+    return static_cast<int>(width_ / gcd(width_, height_) * height_);
+}
+
+int Topology::lineOf(Position p, Direction d) const {
+    int dx = DIRECTION_DX[static_cast<int>(d)], dy = DIRECTION_DY[static_cast<int>(d)];
+    if (dy == 0) return p.getY();
+    if (dx == 0) return p.getX();
+    // one step changes x - y (or x + y, against the other diagonal) by 0 mod gcd
+    int g = static_cast<int>(gcd(width_, height_));
+    int along = dx == dy ? p.getX() - p.getY() : p.getX() + p.getY();
+    return ((along % g) + g) % g;
+}
+
+int Topology::placeOnLine(Position p, Direction d) const {
+    int dx = DIRECTION_DX[static_cast<int>(d)], dy = DIRECTION_DY[static_cast<int>(d)];
+    Position first = dy == 0 ? Position(0, p.getY()) : dx == 0 ? Position(p.getX(), 0) : Position(lineOf(p, d), 0);
+    return stepsAlong(first, d, p);
+}
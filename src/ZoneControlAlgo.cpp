@@ -1,7 +1,16 @@
 #include "../include/ZoneControlAlgo.h"
-#include "../include/Wall.h"
-#include <cmath>
-#include <climits>
+
+namespace {
+    // the first tank a shell fired from `from` in direction d meets (before any wall) is one of ours.
+    //without a fire matrix the tanks in between are not known - none is assumed
+    bool allyInTheWay(const FireMatrix* fire, Position from, Direction d) {
+        if (!fire) return false;
+        int self = fire->tankAt(from);
+        if (self == FireMatrix::NONE) return false;
+        FireMatrix::Aim aim = fire->aim(self, d);
+        return aim.tank != FireMatrix::NONE && fire->getTanks()[aim.tank].player == fire->getTanks()[self].player;
+    }
+}
 
 ZoneControlAlgo::ZoneControlAlgo(int tankId)
         : tankId_(tankId), zoneStart_(0), zoneEnd_(0), turnsSinceLastUpdate_(0), 
@@ -15,167 +24,64 @@ void ZoneControlAlgo::updateZoneRange(int startX, int endX) {
     }
 }
 
-Direction getDirectionTo(const Position& from, const Position& to) {
-    if (to.getX() > from.getX()) return Direction::Right;
-    if (to.getX() < from.getX()) return Direction::Left;
-    if (to.getY() > from.getY()) return Direction::Down;
-    if (to.getY() < from.getY()) return Direction::Up;
-    return Direction::Up;
-}
-
-Position findWallCoverInZone(const Tank& self, const Board& board, int zoneStart, int zoneEnd) {
-    Position myPos = self.getPosition();
-    int minDistance = INT_MAX;
-    Position bestCover(-1, -1);
-
-    for (int y = 0; y < board.getHeight(); ++y) {
-        for (int x = zoneStart; x <= zoneEnd; ++x) {
-            Position wallPos(x, y);
-            for (GameObject* obj : board.getObjectsAt(wallPos)) {
-                if (!dynamic_cast<Wall*>(obj)) continue;
-
-                std::vector<Position> adjacent = {
-                        Position(x + 1, y), Position(x - 1, y),
-                        Position(x, y + 1), Position(x, y - 1)
-                };
-
-                for (const Position& adj : adjacent) {
-                    if (adj.getX() < zoneStart || adj.getX() > zoneEnd) continue;
-                    const auto& objects = board.getObjectsAt(adj);
-                    if (!objects.empty()) continue;
-
-                    int dist = abs(myPos.getX() - adj.getX()) + abs(myPos.getY() - adj.getY());
-                    if (dist < minDistance) {
-                        minDistance = dist;
-                        bestCover = adj;
-                    }
-                }
-            }
-        }
-    }
-
-    return bestCover;
-}
-
-ActionRequest ZoneControlAlgo::decideNextAction(
-        const Tank& self,
-        const Board& board,
-        const std::vector<std::unique_ptr<Tank>>& enemyTanks,
-        const std::vector<std::unique_ptr<Shell>>& shells,
-        const std::vector<std::unique_ptr<Mine>>& mines)
+ActionRequest ZoneControlAlgo::decideNextAction(const ZoneWorldModel& board)
 {
-    Position myPos = self.getPosition();
-    Direction myDir = self.getDirection();
+    Position myPos = board.getSelfPosition();
+    Direction myDir = board.getSelfDirection();
+
+    const Topology& topology = board.getTopology();
 
-    // 1. Zone enforcement
+    // 1. Zone enforcement (the short way to the zone centre, across the edge if need be)
     int zoneCenterX = (zoneStart_ + zoneEnd_) / 2;
-    int dx = zoneCenterX - myPos.getX();
+    int dx = topology.deltaX(myPos.getX(), zoneCenterX);
 
-    if (std::abs(dx) > 0) {
+    if (dx != 0) {
         if (dx > 0 && myDir != Direction::Right) return ActionRequest::RotateRight90;
         if (dx < 0 && myDir != Direction::Left) return ActionRequest::RotateLeft90;
         return ActionRequest::MoveForward;
     }
 
-    // 2. Shell avoidance
-    auto isHorizontal = [](Direction dir) {
-        return dir == Direction::Left || dir == Direction::Right;
-    };
-    auto isVertical = [](Direction dir) {
-        return dir == Direction::Up || dir == Direction::Down;
-    };
-    auto isFacingEscape = [&](Direction tankDir, Direction shellDir) {
-        if (isHorizontal(shellDir)) return isVertical(tankDir);
-        if (isVertical(shellDir)) return isHorizontal(tankDir);
-        return true;
-    };
-
-    for (const auto& shell : shells) {
-        Position sPos = shell->getPosition();
-        Direction sDir = shell->getDirection();
-
-        if (sPos.getY() == myPos.getY()) {
-            if (sDir == Direction::Right && sPos.getX() < myPos.getX()) {
-                if ((myPos.getX() - sPos.getX()) / 2 <= 3) {
-                    if (!isFacingEscape(myDir, sDir)) return ActionRequest::RotateRight90;
-                    return ActionRequest::MoveForward;
-                }
-            }
-            if (sDir == Direction::Left && sPos.getX() > myPos.getX()) {
-                if ((sPos.getX() - myPos.getX()) / 2 <= 3) {
-                    if (!isFacingEscape(myDir, sDir)) return ActionRequest::RotateRight90;
-                    return ActionRequest::MoveForward;
-                }
-            }
-        }
-
-        if (sPos.getX() == myPos.getX()) {
-            if (sDir == Direction::Down && sPos.getY() < myPos.getY()) {
-                if ((myPos.getY() - sPos.getY()) / 2 <= 3) {
-                    if (!isFacingEscape(myDir, sDir)) return ActionRequest::RotateRight90;
-                    return ActionRequest::MoveForward;
-                }
-            }
-            if (sDir == Direction::Up && sPos.getY() > myPos.getY()) {
-                if ((sPos.getY() - myPos.getY()) / 2 <= 3) {
-                    if (!isFacingEscape(myDir, sDir)) return ActionRequest::RotateRight90;
-                    return ActionRequest::MoveForward;
-                }
-            }
-        }
+    // 2. Shell avoidance: a shell may get to our cell within DODGE_STEPS steps - step out,
+    //if the cell ahead is free and safe for longer, else turn to look for one.
+    //the threat map counts steps from the battle info's snapshot, and the shells have moved once
+    //a turn since (the turn it came in included): the steps up to turnsSinceLastUpdate_ are past
+    const ShellThreatMap& threats = currentInfo_ && currentInfo_->getShellThreats() ? *currentInfo_->getShellThreats()
+                                                                                    : ownThreats_;
+    const int elapsed = turnsSinceLastUpdate_;
+    int hitStep = threats.firstHitStep(myPos);
+    if (hitStep > elapsed && hitStep <= elapsed + DODGE_STEPS) {
+        Position ahead = topology.step(myPos, myDir);
+        int aheadStep = threats.firstHitStep(ahead);
+        if (!board.isWall(ahead) && (aheadStep <= elapsed || aheadStep > hitStep)) return ActionRequest::MoveForward;
+        return ActionRequest::RotateRight90;
     }
 
-    // 3. Enemy check + line of sight (with optional wall clearing)
-    for (const auto& enemy : enemyTanks) {
-        Position ePos = enemy->getPosition();
+    // 3. Enemy check + line of sight (with optional wall clearing), in all 8 directions
+    //the battle info doesn't tell our shells left or cooldown - we try, and the game ignores
+    //a shot we can't take
+    //the player's fire matrix also knows the tanks in between (no shooting through an ally);
+    //without one, the line of fire only knows the walls
+    const FireMatrix* fire = currentInfo_ ? currentInfo_->getFireMatrix() : nullptr;
+    const LineOfFire& lineOfFire = currentInfo_ && currentInfo_->getLineOfFire() ? *currentInfo_->getLineOfFire()
+                                                                                 : board.getLineOfFire();
+    for (const Position& ePos : board.getEnemies()) {
 
         if (ePos.getX() >= zoneStart_ && ePos.getX() <= zoneEnd_) {
-            if (ePos.getY() == myPos.getY()) {
-                int minX = std::min(myPos.getX(), ePos.getX());
-                int maxX = std::max(myPos.getX(), ePos.getX());
-                bool wallInPath = false, clearLine = true;
-                for (int x = minX + 1; x < maxX; ++x) {
-                    for (auto obj : board.getObjectsAt({x, myPos.getY()})) {
-                        if (dynamic_cast<Wall*>(obj)) { wallInPath = true; clearLine = false; break; }
-                    }
-                    if (!clearLine) break;
-                }
-                if (clearLine && ((ePos.getX() > myPos.getX() && myDir == Direction::Right) ||
-                                  (ePos.getX() < myPos.getX() && myDir == Direction::Left)))
-                    return ActionRequest::Shoot;
-                if (wallInPath && self.getShellsLeft() > 0 && !self.getIsWaitingAfterShoot()) {
-                    if ((ePos.getX() > myPos.getX() && myDir == Direction::Right) ||
-                        (ePos.getX() < myPos.getX() && myDir == Direction::Left))
-                        return ActionRequest::Shoot;
-                }
-            }
-
-            if (ePos.getX() == myPos.getX()) {
-                int minY = std::min(myPos.getY(), ePos.getY());
-                int maxY = std::max(myPos.getY(), ePos.getY());
-                bool wallInPath = false, clearLine = true;
-                for (int y = minY + 1; y < maxY; ++y) {
-                    for (auto obj : board.getObjectsAt({myPos.getX(), y})) {
-                        if (dynamic_cast<Wall*>(obj)) { wallInPath = true; clearLine = false; break; }
-                    }
-                    if (!clearLine) break;
-                }
-                if (clearLine && ((ePos.getY() > myPos.getY() && myDir == Direction::Down) ||
-                                  (ePos.getY() < myPos.getY() && myDir == Direction::Up)))
-                    return ActionRequest::Shoot;
-                if (wallInPath && self.getShellsLeft() > 0 && !self.getIsWaitingAfterShoot()) {
-                    if ((ePos.getY() > myPos.getY() && myDir == Direction::Down) ||
-                        (ePos.getY() < myPos.getY() && myDir == Direction::Up))
-                        return ActionRequest::Shoot;
-                }
-            }
+            if (fire ? fire->canShoot(myPos, myDir, ePos) : lineOfFire.canHit(myPos, myDir, ePos))
+                return ActionRequest::Shoot;
+            //a wall in the way: shoot it down, if the enemy is the short way along our row or column
+            //and the wall is the first thing the shell meets (no ally before it)
+            if ((ePos.getY() == myPos.getY() || ePos.getX() == myPos.getX()) && !(ePos == myPos) &&
+                myDir == topology.directionTo(myPos, ePos) &&
+                lineOfFire.clearCells(myPos, myDir) < topology.stepsAlong(myPos, myDir, ePos) &&
+                !allyInTheWay(fire, myPos, myDir))
+                return ActionRequest::Shoot;
         }
     }
 
     // 4. Move toward cover if idle
-    Position cover = findWallCoverInZone(self, board, zoneStart_, zoneEnd_);
-    if (cover.getX() != -1) {
-        Direction toCover = getDirectionTo(myPos, cover);
+    Direction toCover;
+    if (cover_.directionToCover(board, zoneStart_, zoneEnd_, myPos, toCover)) {
         if (myDir != toCover) return ActionRequest::RotateRight90;
         return ActionRequest::MoveForward;
     }
@@ -186,26 +92,7 @@ ActionRequest ZoneControlAlgo::decideNextAction(
 ActionRequest ZoneControlAlgo::getAction() {
     turnsSinceLastUpdate_++;
 
-    if (currentInfo_.has_value()) {
-        const MyBattleInfo& info = *currentInfo_;
-        size_t currentEnemyCount = 0, currentAllyCount = 0;
-        char enemySymbol = (tankId_ == 1) ? '2' : '1';
-        char allySymbol = (tankId_ == 1) ? '1' : '2';
-
-        for (size_t y = 0; y < info.getRows(); ++y) {
-            for (size_t x = 0; x < info.getCols(); ++x) {
-                char obj = info.getObjectAt(x, y);
-                if (obj == enemySymbol) currentEnemyCount++;
-                else if (obj == allySymbol || obj == '%') currentAllyCount++;
-            }
-        }
-
-        bool allyDestroyed = lastKnownAllyCount_ > 0 && currentAllyCount < lastKnownAllyCount_;
-        lastKnownEnemyCount_ = currentEnemyCount;
-        lastKnownAllyCount_ = currentAllyCount;
-        if (allyDestroyed) return ActionRequest::GetBattleInfo;
-    }
-
+    //a lost ally is noticed in updateBattleInfo, when the counts arrive
     if (forceUpdateNextTurn_) {
         forceUpdateNextTurn_ = false;
         return ActionRequest::GetBattleInfo;
@@ -215,38 +102,7 @@ ActionRequest ZoneControlAlgo::getAction() {
         return ActionRequest::GetBattleInfo;
     }
 
-    const MyBattleInfo& myInfo = *currentInfo_;
-    Board board(myInfo.getCols(), myInfo.getRows());
-    std::vector<std::unique_ptr<Tank>> enemyTanks;
-    std::vector<std::unique_ptr<Shell>> shells;
-    std::vector<std::unique_ptr<Mine>> mines;
-
-    auto selfPos = myInfo.getSelfPosition();
-    Direction selfDir = myInfo.inferSelfDirection();  // ✅ Use inferred direction
-    Tank self(Position(selfPos.first, selfPos.second), selfDir, tankId_, 0);
-
-    char enemySymbol = (tankId_ == 1) ? '2' : '1';
-    char allySymbol = (tankId_ == 1) ? '1' : '2';
-
-    for (size_t y = 0; y < myInfo.getRows(); ++y) {
-        for (size_t x = 0; x < myInfo.getCols(); ++x) {
-            char obj = myInfo.getObjectAt(x, y);
-            Position pos(x, y);
-
-            if (obj == '#') {
-                board.addGameObject(new Wall(pos), pos);
-            } else if (obj == enemySymbol) {
-                auto enemyTank = std::make_unique<Tank>(pos, Direction::Up, 3 - tankId_, enemyTanks.size());
-                enemyTanks.push_back(std::move(enemyTank));
-            } else if (obj == '*') {
-                shells.push_back(std::make_unique<Shell>(pos, Direction::Up, 0));
-            } else if (obj == '@') {
-                mines.push_back(std::make_unique<Mine>(pos));
-            }
-        }
-    }
-
-    return decideNextAction(self, board, enemyTanks, shells, mines);
+    return decideNextAction(world_);
 }
 
 void ZoneControlAlgo::updateBattleInfo(BattleInfo& info) {
@@ -258,20 +114,14 @@ void ZoneControlAlgo::updateBattleInfo(BattleInfo& info) {
 
     currentInfo_ = *myInfoPtr;
     turnsSinceLastUpdate_ = 0;
+    world_.update(*myInfoPtr);
+    if (!myInfoPtr->getShellThreats()) ownThreats_.compute(*myInfoPtr->getSnapshot(), THREAT_HORIZON);
 
     const MyBattleInfo& myInfo = *myInfoPtr;
-    size_t currentEnemyCount = 0;
-    size_t currentAllyCount = 0;
-    char enemySymbol = (tankId_ == 1) ? '2' : '1';
-    char allySymbol = (tankId_ == 1) ? '1' : '2';
 
-    for (size_t y = 0; y < myInfo.getRows(); ++y) {
-        for (size_t x = 0; x < myInfo.getCols(); ++x) {
-            char obj = myInfo.getObjectAt(x, y);
-            if (obj == enemySymbol) currentEnemyCount++;
-            else if (obj == allySymbol || obj == '%') currentAllyCount++;
-        }
-    }
+    //our own '%' counts as an ally
+    size_t currentEnemyCount = myInfo.getEnemies().size();
+    size_t currentAllyCount = myInfo.getAllyCount() + 1;
 
     bool enemyDestroyed = lastKnownEnemyCount_ > 0 && currentEnemyCount < lastKnownEnemyCount_;
     bool allyDestroyed = lastKnownAllyCount_ > 0 && currentAllyCount < lastKnownAllyCount_;
@@ -279,19 +129,13 @@ void ZoneControlAlgo::updateBattleInfo(BattleInfo& info) {
     if (enemyDestroyed) forceUpdateNextTurn_ = true;
 
     if (allyDestroyed && totalBoardWidth_ > 0) {
+        //our place among our tanks (us included), in the order the board is scanned in - our
+        //own cell, in the list too, isn't before itself
+        Position self = myInfo.getSelf();
+        int tankCount = static_cast<int>(currentAllyCount);
         int tankIndex = 0;
-        int tankCount = 0;
-        auto selfPos = myInfo.getSelfPosition();
-
-        for (size_t y = 0; y < myInfo.getRows(); ++y) {
-            for (size_t x = 0; x < myInfo.getCols(); ++x) {
-                char obj = myInfo.getObjectAt(x, y);
-                if (obj == allySymbol || obj == '%') {
-                    if (x == selfPos.first && y == selfPos.second)
-                        tankIndex = tankCount;
-                    tankCount++;
-                }
-            }
+        for (const Position& ally : myInfo.getAllies()) {
+            if (BattlefieldSnapshot::isBefore(ally, self)) tankIndex++;
         }
 
         if (tankCount > 0) {
@@ -303,4 +147,5 @@ void ZoneControlAlgo::updateBattleInfo(BattleInfo& info) {
 
     lastKnownEnemyCount_ = currentEnemyCount;
     lastKnownAllyCount_ = currentAllyCount;
-}
\ No newline at end of file
+}
+
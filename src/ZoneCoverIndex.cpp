@@ -0,0 +1,58 @@
+#include "../include/ZoneCoverIndex.h"
+#include <algorithm>
+
+bool ZoneCoverIndex::directionToCover(const ZoneWorldModel& world, int zoneStart, int zoneEnd, Position from,
+                                      Direction& dir) {
+    zoneStart = std::max(zoneStart, 0);
+    zoneEnd = std::min(zoneEnd, world.getWidth() - 1);
+    if (!built_ || zoneStart != zoneStart_ || zoneEnd != zoneEnd_ || world.getWidth() != width_ ||
+        world.getHeight() != height_ || world.getWallsVersion(zoneStart, zoneEnd) != wallsVersion_) {
+        rebuild(world, zoneStart, zoneEnd);
+    }
+
+    if (from.getX() < zoneStart_ || from.getX() > zoneEnd_ || from.getY() < 0 || from.getY() >= height_) {
+        return false;
+    }
+    int32_t here = dist_[from.getY() * gridWidth_ + from.getX() - zoneStart_];
+    if (here <= 0) return false;
+
+    const Topology& topology = world.getTopology();
+    for (Direction d : Topology::NEIGHBOURS_4) {
+        Position next = topology.step(from, d);
+        if (next.getX() < zoneStart_ || next.getX() > zoneEnd_) continue;
+        if (dist_[next.getY() * gridWidth_ + next.getX() - zoneStart_] == here - 1) {
+            dir = d;
+            return true;
+        }
+    }
+    return false;
+}
+
+void ZoneCoverIndex::rebuild(const ZoneWorldModel& world, int zoneStart, int zoneEnd) {
+    zoneStart_ = zoneStart;
+    zoneEnd_ = zoneEnd;
+    width_ = world.getWidth();
+    height_ = world.getHeight();
+    wallsVersion_ = world.getWallsVersion(zoneStart, zoneEnd);
+    built_ = true;
+
+    int zoneWidth = std::max(zoneEnd_ - zoneStart_ + 1, 0);
+    gridWidth_ = zoneWidth == width_ || zoneWidth == 0 ? zoneWidth : zoneWidth + 1;
+    free_.reset(gridWidth_, height_);
+    coverBits_.reset(gridWidth_, height_);
+
+    // cover: a free zone cell with a wall of the zone next to it
+    auto zoneWall = [&](int x, int y) {
+        return x >= zoneStart_ && x <= zoneEnd_ && y >= 0 && y < height_ && world.isWall(Position(x, y));
+    };
+    for (int y = 0; y < height_; ++y) {
+        for (int x = zoneStart_; x <= zoneEnd_; ++x) {
+            if (world.isWall(Position(x, y))) continue;
+            free_.set(x - zoneStart_, y);
+            if (zoneWall(x + 1, y) || zoneWall(x - 1, y) || zoneWall(x, y + 1) || zoneWall(x, y - 1)) {
+                coverBits_.set(x - zoneStart_, y);
+            }
+        }
+    }
+    flood_.distances(free_, coverBits_, dist_);
+}
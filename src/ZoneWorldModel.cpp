@@ -0,0 +1,46 @@
+#include "../include/ZoneWorldModel.h"
+#include <algorithm>
+
+void ZoneWorldModel::update(const MyBattleInfo& info) {
+    int width = static_cast<int>(info.getCols());
+    int height = static_cast<int>(info.getRows());
+
+    const DeltaBattleInfo* delta = info.getDelta();
+    if (delta && sequence_ != 0 && delta->baseSequence == sequence_ && width == topology_.getWidth() && height == topology_.getHeight()) {
+        for (const auto& cell : delta->cells) {
+            uint8_t wall = cell.symbol == '#';
+            int index = cell.y * width + cell.x;
+            if (walls_[index] == wall) continue;
+            walls_[index] = wall;
+            columnVersions_[cell.x] = ++wallsVersion_;
+            if (lineOfFireCurrent_) lineOfFire_.wallChanged(walls_.data(), index);
+        }
+    } else {
+        topology_ = Topology(width, height);
+        columnVersions_.assign(width, ++wallsVersion_);
+        walls_.assign(static_cast<size_t>(width) * height, 0);
+        for (const Position& pos : info.getWalls()) walls_[topology_.indexOf(pos)] = 1;
+        lineOfFireCurrent_ = false;
+    }
+    sequence_ = info.getSequence();
+
+    if (!info.getLineOfFire()) {
+        if (!lineOfFireCurrent_) lineOfFire_.build(topology_, walls_.data());
+        lineOfFireCurrent_ = true;
+    } else if (lineOfFireCurrent_) {
+        lineOfFire_ = LineOfFire();  // the player's is used - let ours go
+        lineOfFireCurrent_ = false;
+    }
+
+    selfPos_ = info.getSelf();
+    selfDir_ = info.inferSelfDirection();
+
+    enemies_.assign(info.getEnemies().begin(), info.getEnemies().end());
+}
+
+uint64_t ZoneWorldModel::getWallsVersion(int fromX, int toX) const {
+    fromX = std::max(fromX, 0);
+    toX = std::min(toX, getWidth() - 1);
+    if (fromX > toX) return 0;
+    return *std::max_element(columnVersions_.begin() + fromX, columnVersions_.begin() + toX + 1);
+}